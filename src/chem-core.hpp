@@ -7,6 +7,7 @@
 #include "services/rack-em-convert.hpp"
 #include "services/midi-devices.hpp"
 #include "services/haken-midi.hpp"
+#include "services/macro-scheduler.hpp"
 
 namespace pachde {
 
@@ -35,6 +36,32 @@ struct IPresetList
 };
 
 
+// Immutable, pre-digested description of the live preset.
+// The host builds one per preset change and every client shares it,
+// rather than each client copying the preset and re-parsing its metadata.
+struct PresetSnapshot
+{
+    std::shared_ptr<const PresetInfo> preset;
+    std::string meta_text;
+    // position in the host system and user lists when the snapshot was taken, or -1
+    ssize_t system_index{-1};
+    ssize_t user_index{-1};
+
+    PresetId id() const { return preset->id; }
+
+    // Index of the preset in a host list.
+    // Lists can be re-sorted after the snapshot is made, so the cached index
+    // is checked before it's used, falling back to a search.
+    ssize_t index_in(eaganmatrix::PresetTab tab, PresetList* list) const {
+        if (!list) return -1;
+        ssize_t index = (eaganmatrix::PresetTab::User == tab) ? user_index : system_index;
+        if ((index >= 0) && (index < list->size()) && (list->presets[index]->id.key() == preset->id.key())) {
+            return index;
+        }
+        return list->index_of_id(preset->id);
+    }
+};
+
 struct IChemHost
 {
     virtual void register_chem_client(IChemClient* client) = 0;
@@ -44,11 +71,17 @@ struct IChemHost
     virtual std::shared_ptr<MidiDeviceConnection> host_connection(ChemDevice device) = 0;
     virtual std::string host_claim() = 0;
     virtual bool host_busy() = 0;
+    // fraction of the host's MIDI output queue in use (0..1)
+    virtual float host_midi_load() = 0;
     virtual HakenMidi* host_haken() = 0;
+    virtual MacroScheduler* host_macro_scheduler() = 0;
     virtual eaganmatrix::EaganMatrix* host_matrix() = 0;
     virtual const eaganmatrix::PresetDescription* host_preset() = 0;
+    virtual std::shared_ptr<const PresetSnapshot> host_preset_snapshot() = 0;
     virtual IPresetList* host_ipreset_list() = 0;
     virtual void request_preset(ChemId tag, PresetId id) = 0;
+    // target of the latest preset request not yet loaded (invalid when none)
+    virtual PresetId host_pending_preset() = 0;
 };
 
 struct IChemClient
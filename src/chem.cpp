@@ -119,10 +119,62 @@ void ChemModuleWidget::set_extender_theme(LeftRight which, const std::string &na
     }
 }
 
+// Reparse just the files that changed since they were loaded, and refresh the modules using them.
+static void hot_reload_changed_files()
+{
+    auto themes = reloadChangedThemes();
+    auto files = ThemedSvgCache::get()->reloadChanged();
+    if (themes.empty() && files.empty()) return;
+    for (auto mw: APP->scene->rack->getModules()) {
+        auto chem = dynamic_cast<ChemModuleWidget*>(mw);
+        if (chem) {
+            chem->on_files_changed(themes, files);
+        }
+    }
+}
+
 void ChemModuleWidget::hot_reload() {
-    reloadThemeCache();
-    module_svgs.reloadAll();
-    setThemeName(getThemeName(), nullptr);
+    hot_reload_changed_files();
+}
+
+static bool contains(const std::vector<std::string>& list, const std::string& item)
+{
+    return list.cend() != std::find(list.cbegin(), list.cend(), item);
+}
+
+void ChemModuleWidget::on_files_changed(const std::vector<std::string>& themes, const std::vector<std::string>& files)
+{
+    if (!module) return;
+    bool panel_changed = false;
+    bool svg_changed = false;
+    if (!files.empty()) {
+        auto panel = panelFilename();
+        for (auto& entry: module_svgs.svgs) {
+            if (contains(files, entry.first)) {
+                svg_changed = true;
+                if (entry.first == panel) panel_changed = true;
+            }
+        }
+    }
+    if (panel_changed) {
+        on_panel_reloaded();
+    }
+    if (contains(themes, getActualThemeName())) {
+        setThemeName(getThemeName(), nullptr);
+    } else if (svg_changed) {
+        // reloaded in place, so only the framebuffers are stale
+        svg_theme::sendDirty(this);
+    }
+}
+
+void ChemModuleWidget::on_panel_reloaded()
+{
+    // the shared cache has already hidden the placeholders in every theme's copy
+    if (hot_positions.empty()) return;
+    auto svg = module_svgs.loadSvg(panelFilename());
+    const svg_query::BoundsIndex& bounds = svg_query::cachedBounds(svg, "k:", true);
+    svg_query::positionChangedWidgets(hot_positions, hot_bounds, bounds);
+    hot_bounds = bounds;
 }
 
 void ChemModuleWidget::setThemeName(const std::string& name, void *context)
@@ -153,12 +205,21 @@ std::string ChemModuleWidget::getActualThemeName() {
 }
 
 std::shared_ptr<SvgTheme> ChemModuleWidget::getSvgTheme() {
-    return getThemeCache().getTheme(getActualThemeName());
+    return getTheme(getActualThemeName());
 }
 
 void ChemModuleWidget::step()
 {
     ModuleWidget::step();
+#ifdef DEV_BUILD
+    // watch for edited panels and themes while designing
+    static double last_check{0.0};
+    auto now = system::getTime();
+    if (now - last_check > 1.0) {
+        last_check = now;
+        hot_reload_changed_files();
+    }
+#endif
     setPartnerPanelBorder<ChemModuleWidget>(this);
     if (module) {
         auto chem = getChemModule();
@@ -270,10 +331,7 @@ void ChemModuleWidget::appendContextMenu(Menu *menu)
         }));
 
 
-    menu->addChild(createMenuItem("Hot-reload themes", "F5", [=]() {
-        reloadThemeCache();
-        setThemeName(getThemeName(), this);
-    }));
+    menu->addChild(createMenuItem("Hot-reload themes", "F5", [=]() { hot_reload(); }));
 
 #ifdef LAYOUT_HELP
     menu->addChild(new MenuSeparator);
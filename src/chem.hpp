@@ -4,8 +4,10 @@
 #include "chem-core.hpp"
 #include "services/colors.hpp"
 #include "services/ModuleBroker.hpp"
+#include "services/perf-counters.hpp"
 #include "services/theme.hpp"
 #include "services/svg-theme.hpp"
+#include "services/svg-query.hpp"
 #include "widgets/themed-widgets.hpp"
 #include "widgets/panel-border.hpp"
 
@@ -27,6 +29,11 @@ struct ChemModule : Module, IThemeHolder
     IChemHost* chem_host{nullptr};
     ChemModuleWidget* chem_ui{nullptr};
 
+    PerfTimer perf_process;
+    PerfGroup perf{this, ""};
+
+    ChemModule() { perf.add("process", &perf_process); }
+
     virtual IChemHost* get_host() { return chem_host; };
 
     void set_chem_host(IChemHost* host) { chem_host = host; }
@@ -61,6 +68,13 @@ struct ChemModuleWidget : ModuleWidget, IThemeHolder
     SvgCache module_svgs;
     PartnerPanelBorder * panelBorder {nullptr};
 
+    // Widgets placed from panel "k:" bounds that follow their placeholder on a hot-reload.
+    // Modules opt in by filling these when creating the UI.
+    svg_query::PositionIndex hot_positions;
+    svg_query::BoundsIndex hot_bounds;
+
+    ChemModuleWidget() { module_svgs.owner = this; }
+
     virtual std::string panelFilename() = 0;
     ChemModule* getChemModule() { return static_cast<ChemModule*>(module); }
 
@@ -71,7 +85,11 @@ struct ChemModuleWidget : ModuleWidget, IThemeHolder
     std::shared_ptr<SvgTheme> getSvgTheme();
 
     virtual void createScrews() {}
-    virtual void hot_reload();
+    // F5: reload the theme and svg files changed on disk, in every CHEM module
+    void hot_reload();
+    void on_files_changed(const std::vector<std::string>& themes, const std::vector<std::string>& files);
+    // the panel svg was reloaded, so placeholders are visible again and may have moved
+    virtual void on_panel_reloaded();
     void set_extender_theme(LeftRight which, const std::string& name);
 
     void onHoverKey(const HoverKeyEvent& e) override;
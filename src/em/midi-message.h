@@ -2,6 +2,7 @@
 #pragma once
 #ifndef MIDI_MESSAGE_H_INCLUDED
 #define MIDI_MESSAGE_H_INCLUDED
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,6 +39,12 @@ typedef union PackedMidiMessage {
 
 struct IDoMidi {
     virtual void do_message(PackedMidiMessage message) {}
+    // A batch of messages in transmit order. Override when a batch can be handled more cheaply.
+    virtual void do_messages(const PackedMidiMessage* messages, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            do_message(messages[i]);
+        }
+    }
 };
 
 inline uint8_t midi_status(PackedMidiMessage msg) { return msg.bytes.status_byte & STATUS_MASK; }
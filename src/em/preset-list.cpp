@@ -146,6 +146,54 @@ void PresetList::sort(PresetOrder new_order)
     }
 }
 
+// ----  PresetListRegistry  ----------------------------
+
+PresetListRegistry* PresetListRegistry::get()
+{
+    static PresetListRegistry the_registry;
+    return &the_registry;
+}
+
+std::shared_ptr<PresetList> PresetListRegistry::acquire(const std::string& path)
+{
+    if (path.empty()) return nullptr;
+    std::lock_guard<std::mutex> guard(lock);
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) {
+        return entry.list.expired();
+    }), entries.end());
+
+    for (auto& entry: entries) {
+        if (entry.path == path) {
+            return entry.list.lock();
+        }
+    }
+    auto list = std::make_shared<PresetList>();
+    if (!list->load(path)) return nullptr;
+    entries.push_back(Entry{path, list});
+    return list;
+}
+
+void PresetListRegistry::publish(std::shared_ptr<PresetList> list)
+{
+    if (!list || list->filename.empty()) return;
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto& entry: entries) {
+        if (entry.path == list->filename) {
+            entry.list = list;
+            return;
+        }
+    }
+    entries.push_back(Entry{list->filename, list});
+}
+
+void PresetListRegistry::forget(const std::string& path)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&path](const Entry& entry) {
+        return entry.path == path;
+    }), entries.end());
+}
+
 std::string EMFileId(const std::string& device_name)
 {
     std::string result = device_name;
@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <mutex>
 #include "preset.hpp"
 #include "preset-sort.hpp"
 
@@ -36,6 +37,30 @@ struct PresetList
     void sort(PresetOrder order);
 };
 
+// Process-wide registry of parsed preset lists, keyed by file.
+// The system list file is per hardware class, so every Core bound to the same
+// kind of device shares one parsed list instead of loading its own copy.
+// Shared lists are treated as read-only: a host that rebuilds a list
+// does so in a private list and publishes it when saved.
+struct PresetListRegistry
+{
+    static PresetListRegistry* get();
+
+    // the shared list for the file, loading it if no host holds it
+    std::shared_ptr<PresetList> acquire(const std::string& path);
+    // make a freshly built and saved list the shared one for its file
+    void publish(std::shared_ptr<PresetList> list);
+    void forget(const std::string& path);
+
+private:
+    struct Entry {
+        std::string path;
+        std::weak_ptr<PresetList> list;
+    };
+    std::mutex lock;
+    std::vector<Entry> entries;
+};
+
 std::string preset_file_name(PresetTab which, uint8_t hardware, const std::string& device_name);
 
 }
\ No newline at end of file
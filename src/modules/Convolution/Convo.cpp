@@ -268,11 +268,13 @@ void ConvoModule::process_params(const ProcessArgs &args)
 
 void ConvoModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     running = true;
     ChemModule::process(args);
+    bool sync_ready = modulation.sync_params_ready(args);
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
-    if (init_from_em && modulation.sync_params_ready(args)) {
+    if (sync_ready && init_from_em) {
         modulation.sync_send();
     }
     if (0 == ((args.frame + id) % 45)) {
@@ -48,8 +48,7 @@ CoreModuleWidget::CoreModuleWidget(CoreModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     set_theme_colors();
 
@@ -151,7 +150,7 @@ void CoreModuleWidget::createScrews()
     addChild(createThemedWidget<ThemeScrew>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH), &module_svgs));
 }
 
-void CoreModuleWidget::createMidiPickers(::svg_query::BoundsIndex& bounds)
+void CoreModuleWidget::createMidiPickers(const ::svg_query::BoundsIndex& bounds)
 {
     addChild(firmware_label = createLabel(bounds["k:firmware"], "v00.00", &dytext_style));
 
@@ -189,6 +188,7 @@ void CoreModuleWidget::createMidiPickers(::svg_query::BoundsIndex& bounds)
                 assert(broker);
                 my_module->haken_device.clear();
                 my_module->haken_midi_out.clear();
+                my_module->haken_midi.clear_stream_pokes();
                 my_module->controller1.clear();
                 my_module->controller2.clear();
                 my_module->haken_midi_out.enable();
@@ -201,6 +201,7 @@ void CoreModuleWidget::createMidiPickers(::svg_query::BoundsIndex& bounds)
                 my_module->controller2.connect(nullptr);
                 my_module->haken_midi_in.reset();
                 my_module->haken_midi_out.clear();
+                my_module->haken_midi.clear_stream_pokes();
                 my_module->haken_midi_out.enable();
                 my_module->controller1_midi_in.reset();
                 my_module->controller1_midi_in.enable();
@@ -280,7 +281,8 @@ void CoreModuleWidget::updateIndicators()
                 w->setLook(taskStateColor(state), ChemTask::State::Untried != state);
             }
         }
-        system_presets_indicator->setLook(taskStateColor(my_module->system_presets->empty()
+        auto system_list = my_module->get_system_presets();
+        system_presets_indicator->setLook(taskStateColor((!system_list || system_list->empty())
             ? ChemTask::State::Untried
             : (gather_system(my_module->gathering) ? ChemTask::State::Pending : ChemTask::State::Complete)));
         user_presets_indicator->setLook(taskStateColor(my_module->user_presets->empty()
@@ -368,7 +370,7 @@ void CoreModuleWidget::open_user_preset_file()
 void CoreModuleWidget::set_theme_colors(const std::string& theme_name)
 {
     auto name = theme_name.empty() ? getThemeName() : theme_name;
-    auto theme = getThemeCache().getTheme(name);
+    auto theme = getTheme(name);
     theme_colors[ThemeColor::coHakenMidiIn] = ColorFromTheme(theme, "haken-in", nvgRGB(0x54, 0xa7, 0x54));
     theme_colors[ThemeColor::coHakenMidiOut] = ColorFromTheme(theme, "haken-out", nvgRGB(0x45, 0x56, 0xe7));
 
@@ -389,12 +391,6 @@ void CoreModuleWidget::setThemeName(const std::string& name, void * context)
     ChemModuleWidget::setThemeName(name, context);
 }
 
-void CoreModuleWidget::hot_reload() {
-    Base::hot_reload();
-    auto svg = module_svgs.loadSvg(panelFilename());
-    svg_query::hideElements(svg, "k:");
-}
-
 // IChemClient
 rack::engine::Module* CoreModuleWidget::client_module()
 {
@@ -543,10 +539,35 @@ const NVGcolor& CoreModuleWidget::taskStateColor(ChemTask::State state)
 
 void CoreModuleWidget::step()
 {
+    if (my_module) {
+        CoreModule::UiIntent intent;
+        while (my_module->ui_intents.next(intent)) {
+            apply_intent(intent);
+        }
+    }
     updateIndicators();
     ChemModuleWidget::step();
 }
 
+void CoreModuleWidget::apply_intent(const CoreModule::UiIntent& intent) {
+    switch (intent.kind) {
+    case CoreModule::UiIntent::Status:
+        em_status_label->set_text(intent.text);
+        break;
+    case CoreModule::UiIntent::Scanning:
+        create_stop_button();
+        // fall through
+    case CoreModule::UiIntent::Busy:
+        show_busy(true);
+        if (*intent.text) em_status_label->set_text(intent.text);
+        break;
+    case CoreModule::UiIntent::Idle:
+        show_busy(false);
+        remove_stop_button();
+        break;
+    }
+}
+
 inline float midi_animation_cx(uint64_t count) {
     return static_cast<float>(MIDI_ANIMATION_MARGIN + ((count / 20) % (MODULE_WIDTH - 2*MIDI_ANIMATION_MARGIN)));
 }
@@ -721,7 +742,8 @@ void CoreMenu::appendContextMenu(ui::Menu* menu)
 
         menu->addChild(new MenuSeparator);
 
-        preset_file = my_module->system_presets ? system::getFilename(my_module->system_presets->filename) : "";
+        auto system_list = my_module->get_system_presets();
+        preset_file = system_list ? system::getFilename(system_list->filename) : "";
         no_file = preset_file.empty();
         if (no_file) {
             preset_file = "(none)";
@@ -752,6 +774,61 @@ void CoreMenu::appendContextMenu(ui::Menu* menu)
         [my_module]() { return my_module->is_logging(); },
         [my_module]() { my_module->enable_logging(!my_module->is_logging()); }));
 
+    menu->addChild(createSubmenuItem("Preset timing", "", [my_module](Menu* menu) {
+        auto timing = my_module->preset_timing.get_summary();
+        if (!timing->requests) {
+            menu->addChild(createMenuLabel("No preset changes timed"));
+        } else {
+            menu->addChild(createMenuLabel(format_string("Requests: %u", timing->requests)));
+            menu->addChild(createMenuLabel(format_string("p50: %.0f ms", 1000.0 * timing->p50)));
+            menu->addChild(createMenuLabel(format_string("p95: %.0f ms", 1000.0 * timing->p95)));
+            menu->addChild(createMenuLabel(format_string("max: %.0f ms", 1000.0 * timing->maximum)));
+            menu->addChild(createMenuLabel(format_string("mean: %.0f ms", 1000.0 * timing->mean)));
+            if (timing->begin_count) {
+                menu->addChild(createMenuLabel(format_string("Begin p50: %.0f ms", 1000.0 * timing->begin_p50)));
+            }
+            menu->addChild(new MenuSeparator);
+            menu->addChild(createMenuLabel(format_string("Last: begin %.0f, text %.0f, done %.0f ms",
+                1000.0 * timing->last_begin, 1000.0 * timing->last_text, 1000.0 * timing->last_complete)));
+        }
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createMenuItem("Reset timing", "", [my_module]() {
+            my_module->preset_timing.request_reset();
+        }, !timing->requests));
+    }));
+
+    menu->addChild(createSubmenuItem("Performance counters", "", [](Menu* menu) {
+        menu->addChild(createCheckMenuItem("Time processing", "",
+            [](){ return PerfRegistry::is_enabled(); },
+            [](){ PerfRegistry::enable(!PerfRegistry::is_enabled()); }
+        ));
+        menu->addChild(createMenuItem("Reset counters", "", [](){ PerfRegistry::get()->reset(); }));
+        menu->addChild(createMenuItem("Save as JSON", "", [](){
+            auto registry = PerfRegistry::get();
+            registry->save(registry->default_path());
+        }));
+        menu->addChild(new MenuSeparator);
+
+        auto registry = PerfRegistry::get();
+        std::lock_guard<std::mutex> guard(registry->lock);
+        for (auto group: registry->groups) {
+            std::vector<std::string> lines;
+            for (auto& entry: group->timers) {
+                lines.push_back(format_string("%s: %llu calls, mean %.2f us, max %.1f us",
+                    entry.name.c_str(), static_cast<unsigned long long>(entry.timer->count()),
+                    entry.timer->mean_us(), entry.timer->max_us()));
+            }
+            for (auto& entry: group->counters) {
+                lines.push_back(format_string("%s: %llu", entry.name.c_str(), static_cast<unsigned long long>(entry.counter->get())));
+            }
+            menu->addChild(createSubmenuItem(group->display_name(), "", [lines](Menu* menu) {
+                for (auto& line: lines) {
+                    menu->addChild(createMenuLabel(line));
+                }
+            }));
+        }
+    }));
+
     menu->addChild(createCheckMenuItem("Disconnect MIDI", "",
         [=](){ return my_module->disconnected; },
         [=](){ ui->connect_midi(my_module->disconnected); },
@@ -80,6 +80,15 @@ CoreModule::CoreModule() : modulation(this, ChemId::Core) {
     controller1_midi_in.set_target(&midi_relay);
     controller2_midi_in.set_target(&midi_relay);
 
+    haken_midi_in.register_perf(perf, "haken-in");
+    controller1_midi_in.register_perf(perf, "midi1-in");
+    controller2_midi_in.register_perf(perf, "midi2-in");
+    haken_midi_out.register_perf(perf, "haken-out");
+    midi_relay.register_perf(perf, "relay");
+    macro_scheduler.register_perf(perf, "macros");
+    perf.add("preset.superseded", &perf_preset_superseded);
+    perf.add("preset.timeout", &perf_preset_timeout);
+
     auto broker = MidiDeviceBroker::get();
     broker->registerDeviceHolder(&haken_device);
     broker->registerDeviceHolder(&controller1);
@@ -94,7 +103,7 @@ CoreModule::CoreModule() : modulation(this, ChemId::Core) {
 
     player.init(&haken_midi_out, test_midi_data);
 
-    system_presets = std::make_shared<PresetList>();
+    set_system_presets(std::make_shared<PresetList>());
     user_presets = std::make_shared<PresetList>();
     load_pfis(pfis_filename(), user_preset_file_infos);
 }
@@ -107,7 +116,7 @@ CoreModule::~CoreModule() {
     controller2.unsubscribe(this);
 
     user_presets = nullptr;
-    system_presets = nullptr;
+    set_system_presets(nullptr);
     notify_preset_list_changed(PresetTab::User);
     notify_preset_list_changed(PresetTab::System);
     for (auto client : chem_clients) {
@@ -161,16 +170,21 @@ std::string CoreModule::device_name(ChemDevice which) {
 PresetId CoreModule::prev_next_id(ssize_t increment) {
     ssize_t index{-1};
     PresetId id;
-    if (em.preset.id.valid() && em.preset.id.key()) {
-        index = system_presets->index_of_id(em.preset.id);
+    // step from a requested preset not yet loaded, so quick presses keep moving
+    PresetId current = host_pending_preset();
+    if (!current.valid()) current = em.preset.id;
+    auto system_list = get_system_presets();
+    if (!system_list) return id;
+    if (current.valid() && current.key()) {
+        index = system_list->index_of_id(current);
         if (index >= 0) {
             index = index + increment;
             index = (index < 0)
-                ? system_presets->size() -1
-                : ((index >= system_presets->size()) ? 0 : index);
-            id = system_presets->presets[index]->id;
+                ? system_list->size() -1
+                : ((index >= system_list->size()) ? 0 : index);
+            id = system_list->presets[index]->id;
         } else if (user_presets) {
-            auto index = user_presets->index_of_id(em.preset.id);
+            auto index = user_presets->index_of_id(current);
             if (index >= 0) {
                 index = index + increment;
                 index = (index < 0)
@@ -180,13 +194,13 @@ PresetId CoreModule::prev_next_id(ssize_t increment) {
             }
         }
     } else if (em.preset.tag) {
-        index = system_presets->index_of_tag(em.preset.tag);
+        index = system_list->index_of_tag(em.preset.tag);
         if (index >= 0) {
             index = index + increment;
             index = (index < 0)
-                ? system_presets->size() -1
-                : ((index >= system_presets->size()) ? 0 : index);
-            id = system_presets->presets[index]->id;
+                ? system_list->size() -1
+                : ((index >= system_list->size()) ? 0 : index);
+            id = system_list->presets[index]->id;
         } else if (user_presets) {
             auto index = user_presets->index_of_tag(em.preset.tag);
             if (index >= 0) {
@@ -209,6 +223,7 @@ void CoreModule::next_preset() {
             request_preset(ChemId::Core, id);
         }
     } else {
+        preset_timing.request();
         haken_midi.next_system_preset(ChemId::Core);
     }
 }
@@ -221,13 +236,14 @@ void CoreModule::prev_preset() {
             request_preset(ChemId::Core, id);
         }
     } else {
+        preset_timing.request();
         haken_midi.previous_system_preset(ChemId::Core);
     }
 }
 
 void CoreModule::clear_presets(eaganmatrix::PresetTab which) {
     valid_tab(which);
-    auto list = which == PresetTab::User ? user_presets : system_presets;
+    auto list = which == PresetTab::User ? user_presets : get_system_presets();
     std::string path = list->filename;
 
     if ((PresetTab::User == which) && !path.empty() && !user_preset_file_infos.empty()) {
@@ -239,7 +255,13 @@ void CoreModule::clear_presets(eaganmatrix::PresetTab which) {
             user_preset_file_infos.erase(it);
         }
     }
-    list->clear();
+    if (PresetTab::System == which) {
+        // other hosts may share the list: let go of it rather than clearing it
+        PresetListRegistry::get()->forget(path);
+        set_system_presets(std::make_shared<PresetList>());
+    } else {
+        list->clear();
+    }
     if (!path.empty()) {
         system::remove(path);
     }
@@ -265,8 +287,14 @@ PresetResult CoreModule::load_preset_file(PresetTab which, bool busy_load) {
     if (path.empty()) {
         path = preset_file_name(which, hardware, haken_device.connection->info.input_device_name);
     }
-    auto list = which == PresetTab::User ? user_presets : system_presets;
-    auto result = list->load(path) ? PresetResult::Ok : PresetResult::FileNotFound;
+    if (PresetTab::System == which) {
+        auto shared = PresetListRegistry::get()->acquire(path);
+        if (!shared) return PresetResult::FileNotFound;
+        set_system_presets(shared);
+        notify_preset_list_changed(which);
+        return PresetResult::Ok;
+    }
+    auto result = user_presets->load(path) ? PresetResult::Ok : PresetResult::FileNotFound;
     if (result == PresetResult::Ok) {
         notify_preset_list_changed(which);
     }
@@ -277,10 +305,7 @@ PresetResult CoreModule::load_quick_user_presets() {
     if (em.is_osmose()) return PresetResult::NotApplicableOsmose;
     if (host_busy()) return PresetResult::NotReady;
 
-    if (chem_ui && !ui()->showing_busy()) {
-        ui()->show_busy(true);
-        ui()->em_status_label->set_text("Scanning quick User presets...");
-    }
+    show_busy_now(UiIntent::Busy, "Scanning quick User presets...");
     gathering = QuickUserPresets;
     stash_user_preset_file = user_presets->filename;
     user_presets->clear();
@@ -291,9 +316,8 @@ PresetResult CoreModule::load_quick_user_presets() {
 PresetResult CoreModule::load_quick_system_presets() {
     if (em.is_osmose()) return PresetResult::NotApplicableOsmose;
     if (host_busy()) return PresetResult::NotReady;
-    if (chem_ui && !ui()->showing_busy()) {
-        ui()->show_busy(true);
-    }
+    show_busy_now(UiIntent::Busy);
+    set_system_presets(std::make_shared<PresetList>());
     gathering = QuickSystemPresets;
     haken_midi.request_system(ChemId::Core);
     return PresetResult::Ok;
@@ -304,11 +328,7 @@ PresetResult CoreModule::load_full_user_presets() {
     stash_user_preset_file = user_presets->filename;
     user_presets->clear();
 
-    if (chem_ui && !ui()->showing_busy()) {
-        ui()->show_busy(true);
-        ui()->create_stop_button();
-        ui()->em_status_label->set_text("Scanning full User presets...");
-    }
+    show_busy_now(UiIntent::Scanning, "Scanning full User presets...");
     em.begin_user_scan();
     if (em.is_osmose()) {
         full_build = new PresetListBuildCoordinator(midi_log, true, new OsmosePresetEnumerator(ChemId::Core, 90));
@@ -327,11 +347,7 @@ PresetResult CoreModule::load_full_user_presets() {
 PresetResult CoreModule::scan_osmose_presets(uint8_t page) {
     if (!em.is_osmose()) return PresetResult::NotApplicableEm;
     if (host_busy()) return PresetResult::NotReady;
-    if (chem_ui && !ui()->showing_busy()) {
-        ui()->show_busy(true);
-        ui()->create_stop_button();
-        ui()->em_status_label->set_text(format_string("Scanning User presets (page %d)...", page-90+1));
-    }
+    show_busy_now(UiIntent::Scanning, format_string("Scanning User presets (page %d)...", page-90+1).c_str());
     em.begin_user_scan();
     full_build = new PresetListBuildCoordinator(midi_log, true, new OsmosePresetEnumerator(ChemId::Core, page));
     full_build->start_building();
@@ -389,21 +405,19 @@ std::shared_ptr<PresetList> CoreModule::host_user_presets() {
 }
 
 std::shared_ptr<PresetList> CoreModule::host_system_presets() {
-    if (system_presets && system_presets->empty()) {
+    auto list = get_system_presets();
+    if (list && list->empty()) {
         load_preset_file(PresetTab::System);
+        list = get_system_presets();
     }
-    return system_presets;
+    return list;
 }
 
 PresetResult CoreModule::load_full_system_presets() {
     if (host_busy()) return PresetResult::NotReady;
-    system_presets->clear();
+    set_system_presets(std::make_shared<PresetList>());
 
-    if (chem_ui && !ui()->showing_busy()) {
-        ui()->show_busy(true);
-        ui()->create_stop_button();
-        ui()->em_status_label->set_text("Scanning Full System presets...");
-    }
+    show_busy_now(UiIntent::Scanning, "Scanning Full System presets...");
     em.begin_system_scan();
     if (em.is_osmose()) {
         full_build = new PresetListBuildCoordinator(midi_log, true, new OsmosePresetEnumerator(ChemId::Core, 30, 34));
@@ -441,14 +455,15 @@ PresetResult CoreModule::end_scan() {
     } else {
         assert(gather_system(gather));
         em.end_system_scan();
-        system_presets->sort(PresetOrder::Alpha);
-        system_presets->save(preset_file_name(PresetTab::System, em.get_hardware(), info.input_device_name), em.get_hardware());
+        // still private to this host until it's published
+        auto list = get_system_presets();
+        list->sort(PresetOrder::Alpha);
+        if (list->save(preset_file_name(PresetTab::System, em.get_hardware(), info.input_device_name), em.get_hardware())) {
+            PresetListRegistry::get()->publish(list);
+        }
         tab = PresetTab::System;
     }
-    if (chem_ui) {
-        ui()->show_busy(false);
-        ui()->remove_stop_button();
-    }
+    post_busy(UiIntent::Idle);
     auto fb = full_build;
     full_build = nullptr;
     delete fb;
@@ -460,7 +475,8 @@ PresetResult CoreModule::end_scan() {
 void CoreModule::load_lists() {
     if (host_busy()) return;
     if (!em.get_hardware()) return;
-    if (system_presets->empty()) {
+    auto system_list = get_system_presets();
+    if (system_list && system_list->empty()) {
         if (PresetResult::Ok == load_preset_file(PresetTab::System)) {
             notify_preset_list_changed(PresetTab::System);
         }
@@ -485,12 +501,16 @@ void CoreModule::reboot() {
 
     in_reboot = true;
     disconnected = false;
+    reset_preset_request();
 
     haken_midi_in.clear();
     haken_midi_out.clear();
+    haken_midi.clear_stream_pokes();
     controller1_midi_in.clear();
     controller2_midi_in.clear();
 
+    preset_timing.cancel();
+    macro_scheduler.clear();
     em.reset();
     init_osmose();
     reset_tasks();
@@ -521,12 +541,25 @@ void CoreModule::onPresetBegin() {
         if (PresetListBuildCoordinator::Phase::PendBegin == full_build->phase) {
             full_build->preset_started();
         }
+    } else {
+        preset_timing.preset_begin();
     }
 }
 
 void CoreModule::onPresetChanged() {
     LOG_MSG("Core", format_string("--- Received Preset Changed: %s", em.preset.summary().c_str()));
     in_preset_request = false;
+    preset_request_in_flight.store(PresetId::InvalidKey);
+
+    if (!gathering) {
+        bool outlier{false};
+        if (preset_timing.preset_changed(outlier) && outlier) {
+            auto info = format_string("Slow preset change %.3fs (begin %.3fs, text %.3fs): %s",
+                preset_timing.last_complete, preset_timing.last_begin, preset_timing.last_text, em.preset.name.c_str());
+            LOG_MSG("Core", info);
+            WARN("%s", info.c_str());
+        }
+    }
 
     if (!em.preset.empty()) {
         if (!startup_tasks.completed()) {
@@ -552,11 +585,11 @@ void CoreModule::onPresetChanged() {
                         LOG_MSG("PLB", format_string("[MISMATCH] em[%6x] plb[%6x]", em.osmose_id.key(), em.preset.id.key(), full_build->iter->expected_id().key()));
                     } else {
                         full_build->preset_received();
-                        system_presets->add(&em.preset);
+                        get_system_presets()->add(&em.preset);
                     }
                 } else if (gather_quick(gathering)) {
                     assert(!em.is_osmose());
-                    system_presets->add(&em.preset);
+                    get_system_presets()->add(&em.preset);
                 }
             } else {
                 assert(false);
@@ -578,12 +611,14 @@ void CoreModule::onPresetChanged() {
             }
         }
         if (!found) {
-            if (system_presets->empty()) {
+            auto system_list = get_system_presets();
+            if (system_list->empty()) {
                 load_preset_file(PresetTab::System, true);
+                system_list = get_system_presets();
             }
-            auto index = system_presets->index_of_tag(em.preset.tag);
+            auto index = system_list->index_of_tag(em.preset.tag);
             if (index >= 0) {
-                em.preset.id = system_presets->presets[index]->id;
+                em.preset.id = system_list->presets[index]->id;
             }
         }
     }
@@ -596,15 +631,12 @@ void CoreModule::onPresetChanged() {
 
 void CoreModule::onUserBegin() {
     is_busy = true;
-    if (chem_ui) ui()->show_busy(is_busy);
+    post_busy(UiIntent::Busy);
 }
 
 void CoreModule::onUserComplete() {
     is_busy = false;
-    if (chem_ui) {
-        ui()->show_busy(false);
-        ui()->remove_stop_button();
-    }
+    post_busy(UiIntent::Idle);
     if (QuickUserPresets == gathering) {
         MidiDeviceConnectionInfo info;
         info.parse(haken_device.device_claim);
@@ -620,36 +652,113 @@ void CoreModule::onUserComplete() {
 
 void CoreModule::onSystemBegin() {
     is_busy = true;
-    if (chem_ui) ui()->show_busy(true);
+    post_busy(UiIntent::Busy);
 }
 
 void CoreModule::onSystemComplete() {
     is_busy = false;
-    if (chem_ui) {
-        ui()->show_busy(false);
-        ui()->remove_stop_button();
-    }
+    post_busy(UiIntent::Idle);
     if (QuickSystemPresets == gathering) {
         MidiDeviceConnectionInfo info;
         info.parse(haken_device.device_claim);
-        system_presets->save(preset_file_name(PresetTab::System, em.get_hardware(), info.input_device_name), em.get_hardware());
+        auto list = get_system_presets();
+        if (list->save(preset_file_name(PresetTab::System, em.get_hardware(), info.input_device_name), em.get_hardware())) {
+            PresetListRegistry::get()->publish(list);
+        }
         gathering = GatherFlags::None;
     }
 }
 
 void CoreModule::onMahlingBegin() {
     is_busy = true;
-    if (chem_ui) ui()->show_busy(is_busy);
+    post_busy(UiIntent::Busy);
 }
 
 void CoreModule::onMahlingComplete() {
     is_busy = false;
-    if (chem_ui) ui()->show_busy(is_busy);
+    post_busy(UiIntent::Idle);
 }
 
+// May be called from any thread: the request is sent from process().
 void CoreModule::request_preset(ChemId tag, PresetId id) {
-    if (host_busy()) return;
+    if (!id.valid() || device_busy()) return;
+    if (id.key() == preset_request_in_flight.load()) {
+        // back to the preset already loading: nothing more to send
+        if (preset_request_pending.exchange(0)) {
+            perf_preset_superseded.add();
+        }
+        return;
+    }
+    if (preset_request_pending.exchange(pack_preset_request(tag, id))) {
+        perf_preset_superseded.add();
+    }
+}
+
+PresetId CoreModule::host_pending_preset() {
+    auto pending = preset_request_pending.load(std::memory_order_relaxed);
+    if (pending) return PresetId(static_cast<uint32_t>(pending));
+    return PresetId(preset_request_in_flight.load(std::memory_order_relaxed));
+}
+
+void CoreModule::reset_preset_request() {
+    preset_request_pending.store(0);
+    preset_request_in_flight.store(PresetId::InvalidKey);
+    // the engine-side state is reset by process_preset_request
+    preset_request_reset.store(true);
+}
+
+void CoreModule::process_preset_request(float sample_time) {
+    if (preset_request_reset.exchange(false)) {
+        in_preset_request = false;
+        preset_timing.cancel();
+        preset_request_seen = 0;
+        preset_request_leading = false;
+        preset_request_quiet = 0.f;
+        preset_request_idle = PRESET_DEBOUNCE;
+    }
+    if (preset_request_idle < PRESET_DEBOUNCE) {
+        preset_request_idle += sample_time;
+    }
+    if (in_preset_request) {
+        preset_request_wait += sample_time;
+        if (preset_request_wait > PRESET_LOAD_TIMEOUT) {
+            // never acknowledged: don't hold up the requests queued behind it
+            perf_preset_timeout.add();
+            in_preset_request = false;
+            preset_request_in_flight.store(PresetId::InvalidKey);
+            preset_timing.cancel();
+        }
+    }
+    uint64_t pending = preset_request_pending.load(std::memory_order_relaxed);
+    if (!pending) return;
+
+    if (pending != preset_request_seen) {
+        // leading edge: the first request after a quiet spell goes out immediately
+        preset_request_leading = !preset_request_seen
+            && !in_preset_request
+            && (preset_request_idle >= PRESET_DEBOUNCE);
+        preset_request_seen = pending;
+        preset_request_quiet = 0.f;
+    } else {
+        preset_request_quiet += sample_time;
+    }
+    if (in_preset_request || device_busy()) return;
+    if (!preset_request_leading && (preset_request_quiet < PRESET_DEBOUNCE)) return;
+
+    // a newer request since the load is picked up next time around
+    if (!preset_request_pending.compare_exchange_strong(pending, 0)) return;
+    preset_request_seen = 0;
+    preset_request_leading = false;
+    preset_request_idle = 0.f;
+    send_preset_request(static_cast<ChemId>(uint8_t(pending >> 32)), PresetId(static_cast<uint32_t>(pending)));
+}
+
+void CoreModule::send_preset_request(ChemId tag, PresetId id) {
     in_preset_request = true;
+    preset_request_wait = 0.f;
+    preset_request_in_flight.store(id.key());
+    preset_timing.request();
+    macro_scheduler.clear(); // unsent values belong to the outgoing preset
     em.set_osmose_id(id);
     haken_midi.select_preset(tag, id);
 }
@@ -661,7 +770,29 @@ void CoreModule::notify_connection_changed(ChemDevice device, std::shared_ptr<Mi
     }
 }
 
+std::shared_ptr<const PresetSnapshot> CoreModule::host_preset_snapshot() {
+    auto preset = host_preset();
+    if (!preset) return nullptr;
+
+    // UI threads read the snapshot while the engine replaces it
+    auto snapshot = std::atomic_load(&preset_snapshot);
+    if (snapshot && preset_equal(preset, snapshot->preset.get())) return snapshot;
+
+    auto info = std::make_shared<PresetInfo>(preset);
+    auto fresh = std::make_shared<PresetSnapshot>();
+    fresh->meta_text = info->meta_text();
+    auto system_list = get_system_presets();
+    fresh->system_index = system_list ? system_list->index_of_id(info->id) : -1;
+    fresh->user_index = user_presets ? user_presets->index_of_id(info->id) : -1;
+    fresh->preset = info;
+    snapshot = fresh;
+    std::atomic_store(&preset_snapshot, snapshot);
+    return snapshot;
+}
+
 void CoreModule::notify_preset_changed() {
+    // build the shared snapshot once, before the fan-out
+    host_preset_snapshot();
     for (auto client : chem_clients) {
         client->onPresetChange();
     }
@@ -683,8 +814,9 @@ void CoreModule::onMidiDeviceChange(const MidiDeviceHolder* source) {
         em.ready = false;
         haken_midi_in.ring.clear();
         haken_midi_out.ring.clear();
+        haken_midi.clear_stream_pokes();
         user_presets->clear();
-        system_presets->clear();
+        set_system_presets(std::make_shared<PresetList>());
         if (!disconnected && source->connection) {
             haken_midi_in.setDriverId(source->connection->driver_id);
             haken_midi_in.setDeviceId(source->connection->input_device_id);
@@ -697,6 +829,8 @@ void CoreModule::onMidiDeviceChange(const MidiDeviceHolder* source) {
             haken_midi_out.output.channel = -1;
             LOG_MSG("Core", "--- disconnect HAKEN");
         }
+        preset_timing.cancel();
+        macro_scheduler.clear();
         em.reset();
         init_osmose();
         reset_tasks();
@@ -756,12 +890,13 @@ void CoreModule::onReset(const ResetEvent &e) {
 
 void CoreModule::onRandomize(const RandomizeEvent &e) {
     if (host_busy()) return;
-    if (!user_presets && !system_presets) return;
-    if (user_presets->empty() && system_presets->empty()) return;
+    auto system_list = get_system_presets();
+    if (!user_presets || !system_list) return;
+    if (user_presets->empty() && system_list->empty()) return;
 
     bool user = ::rack::random::uniform() < 0.5f;
-    auto list = user ? user_presets : system_presets;
-    if (!list || list->empty()) list = user ? system_presets : user_presets;
+    auto list = user ? user_presets : system_list;
+    if (!list || list->empty()) list = user ? system_list : user_presets;
     if (list->empty()) return;
     auto index = std::round(::rack::random::uniform() * (list->size() - 1));
     request_preset(ChemId::Core, list->presets[index]->id);
@@ -809,10 +944,12 @@ void CoreModule::connect_midi(bool on) {
     if (disconnected == !on) return;
     disconnected = !on;
     if (disconnected) {
+        reset_preset_request();
         haken_device.connect(nullptr);
         haken_midi_in.clear();
         haken_midi_in.enable(false);
         haken_midi_out.clear();
+        haken_midi.clear_stream_pokes();
         haken_midi_out.enable(false);
         controller1_midi_in.clear();
         controller1_midi_in.enable(false);
@@ -840,6 +977,15 @@ void CoreModule::init_osmose() {
 void CoreModule::do_message(PackedMidiMessage message) {
     if (as_u8(ChemId::Core) == midi_tag(message)) return;
 
+    if (preset_timing.pending()
+        && em.in_preset
+        && (Haken::ctlChg16 == message.bytes.status_byte)
+        && (Haken::ccStream == midi_cc(message))
+        && (Haken::s_StreamEnd == midi_cc_value(message))
+    ) {
+        preset_timing.text_received();
+    }
+
     mm_to_cv.do_message(message);
 
     if (Haken::ctlChg1 != message.bytes.status_byte) return;
@@ -997,6 +1143,31 @@ void CoreModule::process_params(const ProcessArgs &args)
     }
 }
 
+void CoreModule::post_status(const char* format, const char* detail) {
+    if (!chem_ui) return;
+    UiIntent intent;
+    intent.kind = UiIntent::Status;
+    std::snprintf(intent.text, sizeof(intent.text), format, detail);
+    ui_intents.post(intent);
+}
+
+void CoreModule::post_busy(UiIntent::Kind kind, const char* text) {
+    if (!chem_ui) return;
+    UiIntent intent;
+    intent.kind = kind;
+    std::snprintf(intent.text, sizeof(intent.text), "%s", text);
+    ui_intents.post(intent);
+}
+
+// For callers already on the UI thread (the Core menu), which must not post to ui_intents
+void CoreModule::show_busy_now(UiIntent::Kind kind, const char* text) {
+    if (!chem_ui) return;
+    UiIntent intent;
+    intent.kind = kind;
+    std::snprintf(intent.text, sizeof(intent.text), "%s", text);
+    ui()->apply_intent(intent);
+}
+
 void CoreModule::process_gather(const ProcessArgs &args) {
     if (!gathering) return;
 
@@ -1011,7 +1182,7 @@ void CoreModule::process_gather(const ProcessArgs &args) {
             id_builder = nullptr;
             em.unsubscribeEMEvents(t_builder);
             delete t_builder;
-            ui()->em_status_label->set_text("Starting full scan...");
+            post_status("Starting full scan...");
             full_build->start_building();
         } else if (id_builder->end_received && (-1.f == id_builder->end_time)) {
             id_builder->end_time = 0.f;
@@ -1027,7 +1198,9 @@ void CoreModule::process_gather(const ProcessArgs &args) {
     if (full_build) {
         using PHASE = PresetListBuildCoordinator::Phase;
         if (chem_ui && (PHASE::Start == full_build->phase)) {
-            ui()->em_status_label->set_text(format_string("Scanning %s", full_build->iter->next_text().c_str()));
+            char next[24];
+            full_build->iter->next_text(next, sizeof(next));
+            post_status("Scanning %s", next);
         }
         if (!full_build->process(&haken_midi, &em, args)) {
             switch (full_build->get_phase()) {
@@ -1057,9 +1230,13 @@ void set_channels_for_mpe(bool mpe, Output& output) {
 
 void CoreModule::process(const ProcessArgs &args) {
     //DO NOT ChemModule::process(args);
+    PerfScope perf_scope(perf_process);
 
     if (0 == ((args.frame + id) % PROCESS_LIGHT_INTERVAL)) {
         processLights(args);
+        if (ModuleBroker::get()->is_primary(this)) {
+            MidiDeviceBroker::get()->poll_sync();
+        }
         if (ticker.lap()) {
             auto next = getParam(P_NOTHING).getValue() + 1.0f;
             if (next > getParamQuantity(P_NOTHING)->getMaxValue()) {
@@ -1139,11 +1316,19 @@ void CoreModule::process(const ProcessArgs &args) {
         }
     }
 
-    if (haken_midi_out.ring.size() > 2*(haken_midi_out.ring.capacity()/3)) {
-        haken_midi_out.dispatch(DISPATCH_NOW);
-    } else {
-        haken_midi_out.dispatch(sample_time);
+    preset_timing.apply_reset();
+    process_preset_request(sample_time);
+
+    if (macro_scheduler.tick(sample_time) && !host_busy()) {
+        macro_scheduler.send(&haken_midi);
+    }
+
+    float dispatch_time = (haken_midi_out.ring.size() > 2*(haken_midi_out.ring.capacity()/3)) ? DISPATCH_NOW : sample_time;
+    if (haken_midi_out.dispatch_due(dispatch_time)) {
+        // pokes from every client since the last dispatch go out as one sequence per stream
+        haken_midi.flush_stream_pokes();
     }
+    haken_midi_out.dispatch(dispatch_time);
 
     process_gather(args);
 
@@ -7,12 +7,15 @@
 #include "em/preset-list.hpp"
 #include "preset-enum.hpp"
 #include "preset-file-info.hpp"
+#include "preset-timing.hpp"
 #include "relay-midi.hpp"
 #include "services/em-midi-port.hpp"
 #include "services/HakenMidiOutput.hpp"
+#include "services/macro-scheduler.hpp"
 #include "services/midi-devices.hpp"
 #include "services/midi-io.hpp"
 #include "services/svg-query.hpp"
+#include "services/ui-queue.hpp"
 #include "widgets/widgets.hpp"
 #include "wxyz.hpp"
 #include "test-midi.hpp"
@@ -83,6 +86,33 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
     bool is_busy{false};
     bool in_reboot{false};
     bool in_preset_request{false};
+    PresetTiming preset_timing;
+
+    // Preset selection pipeline.
+    // request_preset only publishes the latest target; process() sends it.
+    // A request after a quiet spell is sent at once. While requests keep coming,
+    // or the device is still loading the previous one, only the last target
+    // is sent, once requests have been quiet for PRESET_DEBOUNCE.
+    // A load the device never acknowledges is given up after PRESET_LOAD_TIMEOUT.
+    static constexpr const float PRESET_DEBOUNCE = .15f;
+    static constexpr const float PRESET_LOAD_TIMEOUT = 5.f;
+    std::atomic<uint64_t> preset_request_pending{0}; // pack_preset_request, 0 = none
+    std::atomic<uint32_t> preset_request_in_flight{PresetId::InvalidKey};
+    std::atomic<bool> preset_request_reset{false};
+    uint64_t preset_request_seen{0};
+    float preset_request_quiet{0.f};
+    float preset_request_idle{PRESET_DEBOUNCE};
+    float preset_request_wait{0.f};
+    bool preset_request_leading{false};
+    PerfCounter perf_preset_superseded;
+    PerfCounter perf_preset_timeout;
+    // drop pending and in-flight requests (any thread)
+    void reset_preset_request();
+    static uint64_t pack_preset_request(ChemId tag, PresetId id) {
+        return (uint64_t(1) << 40) | (uint64_t(tag) << 32) | id.key();
+    }
+    void process_preset_request(float sample_time);
+    void send_preset_request(ChemId tag, PresetId id);
     // ui options
     bool glow_knobs{false};
 
@@ -94,7 +124,11 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
     SimpleSlewLimiter z_slew;
 
     std::shared_ptr<PresetList> user_presets{nullptr};
+    // Shared system lists are replaced, never edited, and the pointer is swapped
+    // on either thread, so it is only published and read atomically.
     std::shared_ptr<PresetList> system_presets{nullptr};
+    std::shared_ptr<PresetList> get_system_presets() { return std::atomic_load(&system_presets); }
+    void set_system_presets(std::shared_ptr<PresetList> list) { std::atomic_store(&system_presets, list); }
     std::vector<IPresetListClient*> preset_list_clients;
     GatherFlags gathering{GatherFlags::None};
     PresetIdListBuilder* id_builder{nullptr};
@@ -109,7 +143,26 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
     ChemStartupTasks startup_tasks;
     ChemTask::State start_states[4]{ChemTask::State::Untried};
 
+    // Status line text and busy state from the engine thread, applied by the UI in step().
+    // Single producer: only the engine thread posts. UI-thread callers use show_busy_now.
+    struct UiIntent {
+        enum Kind : uint8_t {
+            Status,   // set the status text
+            Busy,     // show the spinner (and text, if any)
+            Scanning, // Busy, with the stop scan button
+            Idle      // hide the spinner and stop scan button
+        };
+        Kind kind;
+        char text[48];
+    };
+    UiQueue<UiIntent, 16> ui_intents;
+    void post_status(const char* format, const char* detail = "");
+    void post_busy(UiIntent::Kind kind, const char* text = "");
+    void show_busy_now(UiIntent::Kind kind, const char* text = "");
+
     std::vector<IChemClient*> chem_clients;
+    std::shared_ptr<const PresetSnapshot> preset_snapshot{nullptr};
+    MacroScheduler macro_scheduler;
 
     OctaveShiftLeds octave;
     RoundingLeds round_leds;
@@ -186,6 +239,8 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
         if (em.preset.valid()) return &em.preset;
         return nullptr;
     }
+    std::shared_ptr<const PresetSnapshot> host_preset_snapshot() override;
+    MacroScheduler* host_macro_scheduler() override { return &macro_scheduler; }
     HakenMidi* host_haken() override {
         if (disconnected) return nullptr;
         return &haken_midi;
@@ -195,9 +250,12 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
         return &em;
     }
     bool host_busy() override {
+        return in_preset_request || device_busy();
+    }
+    // busy with anything other than loading a preset
+    bool device_busy() {
         return is_busy
             || disconnected
-            || in_preset_request
             || in_reboot
             || !em.ready
             || em.busy()
@@ -205,8 +263,14 @@ struct CoreModule : ChemModule, IChemHost, IMidiDeviceNotify, IHandleEmEvents, I
             || gathering
             ;
     }
+    float host_midi_load() override {
+        // RingBuffer::capacity() is the free space, not the size
+        auto used = haken_midi_out.ring.size();
+        return static_cast<float>(used) / (used + haken_midi_out.ring.capacity());
+    }
     IPresetList* host_ipreset_list() override { return this; }
     void request_preset(ChemId tag, PresetId id) override;
+    PresetId host_pending_preset() override;
 
     void notify_connection_changed(ChemDevice device, std::shared_ptr<MidiDeviceConnection> connection);
     void notify_preset_changed();
@@ -353,7 +417,7 @@ struct CoreModuleWidget : ChemModuleWidget, IChemClient, IHandleEmEvents
 
     CoreMidiPicker* createMidiPicker(Vec pos, const char *tip, MidiDeviceHolder* device, MidiDeviceHolder* haken_device);
 
-    void createMidiPickers(::svg_query::BoundsIndex& bounds);
+    void createMidiPickers(const ::svg_query::BoundsIndex& bounds);
     void createRoundingLeds(Vec pos, float spread);
     void create_stop_button();
     void remove_stop_button();
@@ -364,6 +428,7 @@ struct CoreModuleWidget : ChemModuleWidget, IChemClient, IHandleEmEvents
     void save_as_user_preset_file();
 
     void show_busy(bool busy);
+    void apply_intent(const CoreModule::UiIntent& intent);
     bool showing_busy() { return spinning; }
     void glowing_knobs(bool glow);
 
@@ -384,7 +449,6 @@ struct CoreModuleWidget : ChemModuleWidget, IChemClient, IHandleEmEvents
     void onTaskMessage(uint8_t code) override;
     void onLED(uint8_t led) override;
 
-    void hot_reload() override;
     void setThemeName(const std::string& name, void *context) override;
 
     void drawMidiAnimation(const DrawArgs& args, bool halo);
@@ -86,10 +86,13 @@ void ChemStartupTasks::process(const rack::Module::ProcessArgs& args)
             } else {
                 core->log_message("CoreStart", "HakenDevice");
                 auto broker = MidiDeviceBroker::get();
-                broker->sync();
-                if (!core->is_haken_connected()) {
+                // claims are bound by the primary Core's poll_sync once the enumeration completes
+                if (broker->reconciled() && !core->is_haken_connected()) {
                     broker->bindAvailableEm(&core->haken_device);
                 }
+                if (!core->is_haken_connected()) {
+                    broker->sync();
+                }
                 if (core->is_haken_connected()) {
                     queue.pop_front();
                     core->start_states[ChemTaskId::HakenDevice] = ChemTask::State::Complete;
@@ -6,11 +6,14 @@ namespace pachde {
 
 // ---- HakenPresetEnumerator  ----
 
-std::string HakenPresetEnumerator::next_text()
+void HakenPresetEnumerator::next_text(char* buffer, size_t size)
 {
-    if (current >= ids.size()) return "(complete)";
+    if (current >= ids.size()) {
+        std::snprintf(buffer, size, "(complete)");
+        return;
+    }
     auto id = ids[current];
-    return format_string("[%d.%d.%d]", id.bank_hi(), id.bank_lo(), id.number());
+    std::snprintf(buffer, size, "[%d.%d.%d]", id.bank_hi(), id.bank_lo(), id.number());
 }
 
 bool HakenPresetEnumerator::next(HakenMidi *haken, EaganMatrix *)
@@ -10,7 +10,8 @@ struct IEnumeratePresets
 {
     ChemId chem_id{ChemId::Unknown};
     virtual ~IEnumeratePresets() {}
-    virtual std::string next_text() = 0;
+    // describe the next preset into a fixed buffer (no allocation, engine thread)
+    virtual void next_text(char* buffer, size_t size) = 0;
     virtual PresetId expected_id() = 0;
     virtual bool next(HakenMidi* haken, EaganMatrix * em) = 0;
 };
@@ -27,7 +28,7 @@ struct HakenPresetEnumerator: IEnumeratePresets
         chem_id = source;
     }
     void add(PresetId id) { ids.push_back(id); }
-    std::string next_text() override;
+    void next_text(char* buffer, size_t size) override;
     PresetId expected_id() override { return expected; }
     bool next(HakenMidi* haken, EaganMatrix * em) override;
 };
@@ -86,7 +87,7 @@ struct OsmosePresetEnumerator: IEnumeratePresets
     OsmosePresetEnumerator(ChemId source, uint8_t page, uint8_t last_page) :
     page(page), last_page(last_page) { chem_id = source; }
 
-    std::string next_text() override { return format_string("[%d.%d]", page, index); }
+    void next_text(char* buffer, size_t size) override { std::snprintf(buffer, size, "[%d.%d]", page, index); }
     PresetId expected_id() override { return expected; }
     bool next(HakenMidi* haken, EaganMatrix * em) override;
 };
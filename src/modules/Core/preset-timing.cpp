@@ -0,0 +1,124 @@
+#include "preset-timing.hpp"
+
+namespace pachde {
+
+// A request that never completed (device unplugged, request dropped) is
+// abandoned rather than being charged to an unrelated later preset change.
+constexpr const double STALE_SECONDS = 30.0;
+
+void LatencyHistogram::clear()
+{
+    std::memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    total = 0.0;
+    maximum = 0.0;
+}
+
+void LatencyHistogram::add(double seconds)
+{
+    if (seconds < 0.0) seconds = 0.0;
+    int index = static_cast<int>((seconds * 1000.0) / BUCKET_MS);
+    if (index >= BUCKET_COUNT) index = BUCKET_COUNT - 1;
+    ++buckets[index];
+    ++count;
+    total += seconds;
+    if (seconds > maximum) maximum = seconds;
+}
+
+double LatencyHistogram::percentile(float p) const
+{
+    if (!count) return 0.0;
+    uint32_t target = static_cast<uint32_t>(std::ceil(p * count));
+    if (target < 1) target = 1;
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= target) {
+            double upper = ((i + 1) * BUCKET_MS) / 1000.0;
+            return std::min(upper, maximum);
+        }
+    }
+    return maximum;
+}
+
+void PresetTiming::clear()
+{
+    phase = Idle;
+    request_time = begin_time = text_time = 0.0;
+    last_begin = last_text = last_complete = 0.0;
+    begin.clear();
+    complete.clear();
+    publish();
+}
+
+void PresetTiming::apply_reset()
+{
+    if (reset_requested.exchange(false)) {
+        clear();
+    }
+}
+
+void PresetTiming::publish()
+{
+    auto fresh = std::make_shared<PresetTimingSummary>();
+    fresh->requests = complete.count;
+    fresh->p50 = complete.percentile(.5f);
+    fresh->p95 = complete.percentile(.95f);
+    fresh->maximum = complete.maximum;
+    fresh->mean = complete.mean();
+    fresh->begin_count = begin.count;
+    fresh->begin_p50 = begin.percentile(.5f);
+    fresh->last_begin = last_begin;
+    fresh->last_text = last_text;
+    fresh->last_complete = last_complete;
+    std::atomic_store(&summary, std::shared_ptr<const PresetTimingSummary>(fresh));
+}
+
+void PresetTiming::request()
+{
+    phase = Requested;
+    request_time = rack::system::getTime();
+    begin_time = 0.0;
+    text_time = 0.0;
+}
+
+void PresetTiming::preset_begin()
+{
+    if (Requested != phase) return;
+    begin_time = rack::system::getTime();
+    phase = Begun;
+}
+
+void PresetTiming::text_received()
+{
+    if (Idle == phase) return;
+    // name and text arrive as separate streams: keep the last one
+    text_time = rack::system::getTime();
+    phase = Described;
+}
+
+bool PresetTiming::preset_changed(bool& is_outlier)
+{
+    is_outlier = false;
+    if (Idle == phase) return false;
+    phase = Idle;
+
+    double now = rack::system::getTime();
+    double elapsed = now - request_time;
+    if (elapsed > STALE_SECONDS) return false;
+
+    last_begin = (begin_time > 0.0) ? begin_time - request_time : 0.0;
+    last_text = (text_time > 0.0) ? text_time - request_time : 0.0;
+    last_complete = elapsed;
+
+    if (last_begin > 0.0) {
+        begin.add(last_begin);
+    }
+    is_outlier = (elapsed > OUTLIER_SECONDS)
+        || ((complete.count >= OUTLIER_MIN_HISTORY) && (elapsed > 2.0 * complete.percentile(.95f)));
+    complete.add(elapsed);
+    publish();
+    return true;
+}
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <rack.hpp>
+namespace pachde {
+
+// Latency histogram for preset change requests.
+// Buckets are BUCKET_MS wide. Anything longer lands in the last (overflow) bucket,
+// and the true maximum is tracked separately.
+struct LatencyHistogram
+{
+    static constexpr const int BUCKET_MS = 20;
+    static constexpr const int BUCKET_COUNT = 250; // 5 seconds
+
+    uint32_t buckets[BUCKET_COUNT]{0};
+    uint32_t count{0};
+    double total{0.0};
+    double maximum{0.0};
+
+    void clear();
+    void add(double seconds);
+    bool empty() const { return 0 == count; }
+    double mean() const { return count ? total / count : 0.0; }
+    // upper bound of the bucket containing the given percentile (0..1), in seconds
+    double percentile(float p) const;
+};
+
+// Figures for display, copied from the histograms when they change
+struct PresetTimingSummary
+{
+    uint32_t requests{0};
+    double p50{0.0};
+    double p95{0.0};
+    double maximum{0.0};
+    double mean{0.0};
+    uint32_t begin_count{0};
+    double begin_p50{0.0};
+    double last_begin{0.0};
+    double last_text{0.0};
+    double last_complete{0.0};
+};
+
+// Per-request preset change timing:
+// request -> PresetBegin -> name/text received -> PresetChanged (config complete)
+// The timing is kept by the engine thread. The UI reads the published summary,
+// and asks for a reset, which the engine applies in apply_reset().
+struct PresetTiming
+{
+    enum Phase : uint8_t { Idle, Requested, Begun, Described };
+
+    // Requests taking longer than this are always reported as outliers,
+    // as are requests exceeding twice the current p95 once there's enough history.
+    static constexpr const double OUTLIER_SECONDS = 2.0;
+    static constexpr const uint32_t OUTLIER_MIN_HISTORY = 10;
+
+    Phase phase{Idle};
+    double request_time{0.0};
+    double begin_time{0.0};
+    double text_time{0.0};
+
+    // most recent complete request, in seconds from request
+    double last_begin{0.0};
+    double last_text{0.0};
+    double last_complete{0.0};
+
+    LatencyHistogram begin;
+    LatencyHistogram complete;
+
+    std::atomic<bool> reset_requested{false};
+    std::shared_ptr<const PresetTimingSummary> summary{std::make_shared<PresetTimingSummary>()};
+
+    bool pending() const { return Idle != phase; }
+    void cancel() { phase = Idle; }
+    void clear();
+
+    // UI thread
+    void request_reset() { reset_requested.store(true); }
+    std::shared_ptr<const PresetTimingSummary> get_summary() const { return std::atomic_load(&summary); }
+
+    // engine thread
+    void apply_reset();
+    void publish();
+
+    void request();
+    void preset_begin();
+    void text_received();
+    // Returns true when this completes a timed request.
+    // is_outlier is set when the request was unusually slow.
+    bool preset_changed(bool& is_outlier);
+};
+
+}
@@ -2,6 +2,7 @@
 #include <rack.hpp>
 #include "em/EaganMatrix.hpp"
 #include "em/midi-message.h"
+#include "services/perf-counters.hpp"
 
 namespace pachde{
 
@@ -9,6 +10,13 @@ struct RelayMidi : IDoMidi
 {
     eaganmatrix::EaganMatrix* em{nullptr};
     std::vector<IDoMidi*> targets;
+    PerfCounter perf_relayed;
+    PerfTimer perf_relay;
+
+    void register_perf(PerfGroup& group, const std::string& prefix) {
+        group.add(prefix + ".messages", &perf_relayed);
+        group.add(prefix + ".fan-out", &perf_relay);
+    }
 
     void set_em(eaganmatrix::EaganMatrix* the_em) { em = the_em; }
 
@@ -23,6 +31,8 @@ struct RelayMidi : IDoMidi
     }
 
     void do_message(PackedMidiMessage message) override {
+        PerfScope perf(perf_relay);
+        perf_relayed.add();
         // em first, so targets can use the em's handling of complex processing like hi-res values
         em->onMessage(message);
 
@@ -30,6 +40,20 @@ struct RelayMidi : IDoMidi
             target->do_message(message);
         }
     }
+
+    // The em sees the whole batch before the targets do, so a target reading
+    // em state while handling the batch sees the state at the end of the batch.
+    void do_messages(const PackedMidiMessage* messages, size_t count) override {
+        if (!count) return;
+        PerfScope perf(perf_relay);
+        perf_relayed.add(count);
+        for (size_t i = 0; i < count; ++i) {
+            em->onMessage(messages[i]);
+        }
+        for (auto target: targets) {
+            target->do_messages(messages, count);
+        }
+    }
 };
 
 }
\ No newline at end of file
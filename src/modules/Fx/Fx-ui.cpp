@@ -22,8 +22,7 @@ FxUi::FxUi(FxModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     if (S::show_screws()) {
         createScrews();
@@ -100,7 +99,7 @@ FxUi::FxUi(FxModule *module) :
 }
 
 void FxUi::add_knob(
-    ::svg_query::BoundsIndex& bounds,
+    const ::svg_query::BoundsIndex& bounds,
     const char* knob_key,
     const char * label_key,
     const char * label,
@@ -111,7 +110,7 @@ void FxUi::add_knob(
     addChild(r_labels[index] = createLabel<TipLabel>(bounds[label_key], label, &S::control_label));
 }
 
-void FxUi::add_input(::svg_query::BoundsIndex &bounds, const char* port_key, const char* label_key, const char* click_key, const char* label, int index)
+void FxUi::add_input(const ::svg_query::BoundsIndex& bounds, const char* port_key, const char* label_key, const char* click_key, const char* label, int index)
 {
     Vec pos{bounds[port_key].getCenter()};
     addChild(Center(createThemedColorInput(pos, &module_svgs, my_module, index, S::InputColorKey, PORT_CORN)));
@@ -203,14 +203,16 @@ void FxModule::process_params(const ProcessArgs& args)
 
 void FxModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
+    bool sync_ready = modulation.sync_params_ready(args);
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
     if (((args.frame + id) % 41) == 0) {
         process_params(args);
     }
 
-    if (modulation.sync_params_ready(args)) {
+    if (sync_ready) {
         modulation.sync_send();
     }
 
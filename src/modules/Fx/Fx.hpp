@@ -134,8 +134,8 @@ struct FxUi : ChemModuleWidget, IChemClient
     void glowing_knobs(bool glow);
     void center_knobs();
 
-    void add_knob(::svg_query::BoundsIndex& bounds, const char* knob_key, const char * label_key, const char * label, int index);
-    void add_input(::svg_query::BoundsIndex& bounds, const char* port_key, const char * label_key, const char * click_key, const char * label, int index);
+    void add_knob(const ::svg_query::BoundsIndex& bounds, const char* knob_key, const char * label_key, const char * label, int index);
+    void add_input(const ::svg_query::BoundsIndex& bounds, const char* port_key, const char * label_key, const char * click_key, const char * label, int index);
 
     // IChemClient
     ::rack::engine::Module* client_module() override { return my_module; }
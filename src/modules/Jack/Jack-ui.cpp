@@ -128,6 +128,7 @@ JackUi::JackUi(JackModule *module) :
     addChild(link_button);
 
     module_svgs.changeTheme(theme);
+    symbols.loadSvg(&module_svgs);
     applyChildrenTheme(this, theme);
 
     // init
@@ -145,6 +146,13 @@ JackUi::~JackUi(){
     if (my_module) my_module->set_chem_ui(nullptr);
 }
 
+void JackUi::setThemeName(const std::string& name, void * context)
+{
+    Base::setThemeName(name, context);
+    // the symbol frames aren't in the widget tree, so pick up the newly themed svgs
+    symbols.loadSvg(&module_svgs);
+}
+
 void JackUi::onConnectHost(IChemHost* host)
 {
     chem_host = host;
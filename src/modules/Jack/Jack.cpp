@@ -131,6 +131,7 @@ void JackModule::process_params(const ProcessArgs &args)
 
 void JackModule::process(const ProcessArgs &args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
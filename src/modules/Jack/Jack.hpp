@@ -119,7 +119,7 @@ struct JackUi : ChemModuleWidget, IChemClient
 
     // ChemModuleWidget
     std::string panelFilename() override { return asset::plugin(pluginInstance, "res/panels/CHEM-jack.svg"); }
-    //void setThemeName(const std::string& name, void * context) override;
+    void setThemeName(const std::string& name, void * context) override;
 
     void sync_labels();
     void step() override;
@@ -27,8 +27,7 @@ MacroUi::MacroUi(MacroModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     bool browsing = !module;
 
@@ -119,7 +118,7 @@ MacroUi::MacroUi(MacroModule *module) :
     }
 }
 
-void MacroUi::add_input(::svg_query::BoundsIndex &bounds, const char *port_key, const char *label_key, const char *click_key, const char *label, int index)
+void MacroUi::add_input(const ::svg_query::BoundsIndex& bounds, const char *port_key, const char *label_key, const char *click_key, const char *label, int index)
 {
     Vec pos{bounds[port_key].getCenter()};
     addChild(Center(createThemedColorInput(pos, &module_svgs, my_module, index, S::InputColorKey, PORT_CORN)));
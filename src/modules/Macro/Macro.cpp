@@ -150,7 +150,9 @@ void MacroModule::process_params(const ProcessArgs &args)
 
 void MacroModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
+    bool sync_ready = modulation.sync_params_ready(args);
 
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
@@ -158,7 +160,7 @@ void MacroModule::process(const ProcessArgs& args)
         process_params(args);
     }
 
-    if (modulation.sync_params_ready(args)) {
+    if (sync_ready) {
         modulation.sync_send();
     }
 
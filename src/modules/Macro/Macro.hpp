@@ -138,7 +138,7 @@ struct MacroUi : ChemModuleWidget, IChemClient
     void center_knobs();
 
     void unconnected_ui();
-    void add_input(::svg_query::BoundsIndex& bounds, const char* port_key, const char * label_key, const char * click_key, const char * label, int index);
+    void add_input(const ::svg_query::BoundsIndex& bounds, const char* port_key, const char * label_key, const char * click_key, const char * label, int index);
 
     // IChemClient
     ::rack::engine::Module* client_module() override { return my_module; }
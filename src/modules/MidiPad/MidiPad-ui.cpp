@@ -129,7 +129,7 @@ struct PadEdit : OpaqueWidget
     {
         if (!pad->ok) {
             status->set_text(ellipse_string(pad->error_message, 30));
-            status->describe(pad->error_message);
+            status->describe(pad->error_list);
             midi_field->cursor = pad->error_pos;
             midi_field->selection = pad->error_pos;
         } else {
@@ -500,9 +500,9 @@ void MidiPadUi::send_pad(int id)
     ) {
         auto haken = chem_host->host_haken();
         if (haken) {
-            for (auto m: pad->midi) {
-                haken->send_message(m);
-            }
+            std::vector<PackedMidiMessage> plan;
+            pad->append_plan(plan, (my_module && pad->parameterized()) ? my_module->pad_input(id) : 0.f);
+            haken->send_messages(plan.data(), plan.size());
         }
     }
 }
@@ -12,6 +12,8 @@ MidiPadModule::MidiPadModule()
     configInput( 4, "B1 trigger"); configInput( 5, "B2 trigger"); configInput( 6, "B3 trigger"); configInput( 7, "B4 trigger");
     configInput( 8, "C1 trigger"); configInput( 9, "C2 trigger"); configInput(10, "C3 trigger"); configInput(11, "C4 trigger");
     configInput(12, "D1 trigger"); configInput(13, "D2 trigger"); configInput(14, "D3 trigger"); configInput(15, "D4 trigger");
+
+    transmit.reserve(256);
 }
 
 void MidiPadModule::dataFromJson(json_t* root)
@@ -117,6 +119,16 @@ void MidiPadModule::remove_pad(int id)
     pad_defs[id] = nullptr;
 }
 
+// The value for a pad's `input` variable: the second channel of a polyphonic
+// cable, otherwise the trigger voltage itself.
+float MidiPadModule::pad_input(int id)
+{
+    assert(in_range(id, 0, 15));
+    auto& input = getInput(id);
+    if (!input.isConnected()) return 0.f;
+    return input.getChannels() > 1 ? input.getVoltage(1) : input.getVoltage(0);
+}
+
 // IChemClient
 ::rack::engine::Module* MidiPadModule::client_module() { return this; }
 std::string MidiPadModule::client_claim() { return device_claim; }
@@ -133,6 +145,7 @@ void MidiPadModule::onConnectionChange(ChemDevice device, std::shared_ptr<MidiDe
 
 void MidiPadModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
 
     if (editing) {
@@ -171,20 +184,22 @@ void MidiPadModule::process(const ProcessArgs& args)
         // process inputs
         auto haken = chem_host->host_haken();
         if (haken) {
+            transmit.clear();
             for (int i = 0; i < 16; ++i) {
                 auto pad = pad_defs[i];
                 if (pad && pad->defined()) {
-                    auto input = getInput(i);
+                    auto& input = getInput(i);
                     if (input.isConnected()) {
                         if (trig[i].process(input.getVoltage(), .1f, .5f)) {
                             trig[i].reset();
-                            for (auto m: pad->midi) {
-                                haken->send_message(m);
-                            }
+                            pad->append_plan(transmit, pad->parameterized() ? pad_input(i) : 0.f);
                         }
                     }
                 }
             }
+            if (!transmit.empty()) {
+                haken->send_messages(transmit.data(), transmit.size());
+            }
         }
     }
 }
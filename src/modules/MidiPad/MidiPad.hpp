@@ -40,6 +40,7 @@ struct MidiPadModule : ChemModule, IChemClient, IDoMidi
     std::string title{"Midi Pad"};
     std::shared_ptr<MidiPad> pad_defs[16]{nullptr};
     rack::dsp::SchmittTrigger trig[16];
+    std::vector<PackedMidiMessage> transmit; // plans of the pads fired in this frame
 
     bool editing{false};
     bool first_init{true};
@@ -61,6 +62,7 @@ struct MidiPadModule : ChemModule, IChemClient, IDoMidi
     std::shared_ptr<MidiPad> first_pad();
     void ensure_pad(int id);
     void remove_pad(int id);
+    float pad_input(int id);
 
     // IChemClient
     rack::engine::Module* client_module() override;
@@ -1,6 +1,7 @@
 #include "hcl.hpp"
 #include "chem-id.hpp"
 #include "services/misc.hpp"
+#include "services/perf-counters.hpp"
 
 namespace pachde {
 /*
@@ -20,6 +21,9 @@ namespace pachde {
           pair-list : '[' pair+ ']'
                list : '[' n7+ ']'
 
+  The reserved variable `input` (unless defined by the program) is the value of the
+  pad's input at trigger time. The compiled message is a placeholder recorded in `params`.
+
             channel : `ch` channel-number
        control-code : `cc` n7 cc-value
      program-change : 'pc' n7
@@ -111,9 +115,55 @@ bool is_14bit_cc(uint8_t cc)
 #undef TABLE_BIT
 #undef HI_TABLE_BIT
 
+PerfTimer perf_hcl_compile;
+
+struct HclPerf : PerfGroup {
+    HclPerf() : PerfGroup(nullptr, "HCL") {
+        add("compile", &perf_hcl_compile);
+    }
+} hcl_perf;
+
+// Character classes for the lexer.
+// Lookup is by unsigned char, so any byte in a definition is safe to classify.
+enum CharClass : uint8_t {
+    CC_SPACE      = 1 << 0,
+    CC_DIGIT      = 1 << 1,
+    CC_NAME_START = 1 << 2,
+    CC_NAME       = 1 << 3,
+    CC_OP         = 1 << 4,
+    CC_RATIONAL   = 1 << 5,
+};
+
+struct CharTable
+{
+    uint8_t table[256];
+    CharTable() {
+        std::memset(table, 0, sizeof(table));
+        for (auto c: " \t\r\n\v\f") { table[U8(c)] |= CC_SPACE; }
+        for (int c = '0'; c <= '9'; ++c) { table[c] |= CC_DIGIT | CC_NAME; }
+        for (int c = 'a'; c <= 'z'; ++c) { table[c] |= CC_NAME_START | CC_NAME; }
+        for (int c = 'A'; c <= 'Z'; ++c) { table[c] |= CC_NAME_START | CC_NAME; }
+        table[U8('_')] |= CC_NAME_START | CC_NAME;
+        table[U8('-')] |= CC_NAME;
+        table[U8('$')] |= CC_NAME;
+        for (auto c: "bcfghkmpsv") { table[U8(c)] |= CC_OP; }
+        for (auto c: "+-.,") { table[U8(c)] |= CC_RATIONAL; }
+        table[0] = 0;
+    }
+} char_table;
+
+inline bool is_class(char c, uint8_t char_class) { return 0 != (char_table.table[U8(c)] & char_class); }
+inline bool is_space(char c) { return is_class(c, CC_SPACE); }
+inline bool is_digit(char c) { return is_class(c, CC_DIGIT); }
+
+// name of `length` characters (not terminated) is `text`
+inline bool name_is(const char* name, size_t length, const char* text) {
+    return (0 == std::strncmp(name, text, length)) && (0 == text[length]);
+}
+
 const char * scan_whitespace(const char *scan)
 {
-    while (std::isspace(*scan)) { ++scan; }
+    while (is_space(*scan)) { ++scan; }
     return scan;
 }
 
@@ -131,7 +181,7 @@ const char * scan_comment(const char *scan)
 
 const char * scan_whitespace_or_comment(const char *scan)
 {
-    while (*scan && (('"' == *scan) || (std::isspace(*scan)))) {
+    while (*scan && (('"' == *scan) || is_space(*scan))) {
         scan = ('"' == *scan) ? scan_comment(scan) : scan_whitespace(scan);
     }
     return scan;
@@ -196,35 +246,15 @@ size_t op_len(uint32_t op) {
 
 inline bool is_reserved(Opcode op) { return is_reserved(op.nom()); }
 
-#define OP_BIT(c) (1 << ((c) - 'b'))
-constexpr const uint32_t OP_BITS =
-    1
-    | OP_BIT('c')
-    | OP_BIT('f')
-    | OP_BIT('g')
-    | OP_BIT('h')
-    | OP_BIT('k')
-    | OP_BIT('m')
-    | OP_BIT('p')
-    | OP_BIT('s')
-    | OP_BIT('v')
-    ;
-
-bool is_op_char(char c)
-{
-    return in_range(c, 'b', 'v') ? (0 != (OP_BITS & OP_BIT(c))) : false;
-}
-#undef OP_BIT
+inline bool is_op_char(char c) { return is_class(c, CC_OP); }
 
+// Opcodes are at most 2 characters, so a longer run of opcode characters is not an opcode.
 Opcode get_maybe_opcode(const char * scan)
 {
     Opcode op;
-    auto end = scan;
-    char * poke = &op.code.name[0];
-    while (is_op_char(*end)) {
-        *poke++ = *scan++;
-        ++end;
-        if ((end - scan) > 3) return Opcode{};
+    for (int i = 0; is_op_char(scan[i]); ++i) {
+        if (i == 2) return Opcode{};
+        op.code.name[i] = scan[i];
     }
     return op;
 }
@@ -238,34 +268,16 @@ Opcode get_valid_opcode(const char * scan)
 uint8_t macro_cc(uint8_t macro_number)
 {
     assert(in_range(int(macro_number), 1, 90));
-    uint8_t offset = macro_number - 1;
-    if (macro_number <  7) return offset + Haken::ccI;
-    if (macro_number < 31) return offset + Haken::ccM7;
-    if (macro_number < 49) return offset + Haken::ccM31;
-    if (macro_number < 73) return offset - 49 + Haken::ccM49;
-    return offset - 73 + Haken::ccM73;
-}
-
-bool is_rational_start(char c) {
-    return
-        ('+' == c)
-        || ('-' == c)
-        || ('.' == c)
-        || (',' == c)
-        ;
-}
-
-bool is_name_start(char c) {
-    return ('_' == c) || std::isalpha(c);
+    if (macro_number <  7) return macro_number - 1 + Haken::ccI;
+    if (macro_number < 31) return macro_number - 7 + Haken::ccM7;
+    if (macro_number < 49) return macro_number - 31 + Haken::ccM31;
+    if (macro_number < 73) return macro_number - 49 + Haken::ccM49;
+    return macro_number - 73 + Haken::ccM73;
 }
 
-bool is_name_char(char c) {
-    return ('_' == c)
-        || ('-' == c)
-        || ('$' == c)
-        || std::isalnum(c)
-        ;
-}
+inline bool is_rational_start(char c) { return is_class(c, CC_RATIONAL); }
+inline bool is_name_start(char c) { return is_class(c, CC_NAME_START); }
+inline bool is_name_char(char c) { return is_class(c, CC_NAME); }
 
 const char * HclCompiler::scan_opcode(const char *scan)
 {
@@ -285,25 +297,27 @@ const char * HclCompiler::scan_number(const char *scan, NumberSize size)
     if (seven_bit) {
         ++scan;
     }
-    if (!std::isdigit(*scan)) {
+    if (!is_digit(*scan)) {
         error("Number expected", scan);
         return scan;
     }
 
+    // saturate rather than wrap around on a long run of digits
+    const uint32_t saturated = 1000000;
+    const char * start = scan;
     uint32_t number{0};
     while (*scan) {
-        if (std::isdigit(*scan)) {
-            number = (number*10) + (*scan - '0');
+        if (is_digit(*scan)) {
+            number = std::min(saturated, (number*10) + (*scan - '0'));
         } else if ('_' != *scan) {
             break;
         }
         ++scan;
     }
-    ok = valid_number(number, seven_bit ? NumberSize::SevenBit : size);
-    if (ok) {
+    if (valid_number(number, seven_bit ? NumberSize::SevenBit : size)) {
         value = (seven_bit && (size == NumberSize::FourteenBit)) ? (number << 7) : number;
     } else {
-        error(format_string("%lld is too large for expected %s number", number, bitness(size)), scan);
+        error(format_string("%s is too large for expected %s number", std::string(start, scan).c_str(), bitness(size)), scan);
     }
     return scan;
 }
@@ -311,23 +325,28 @@ const char * HclCompiler::scan_number(const char *scan, NumberSize size)
 const char * HclCompiler::scan_var_number(const char *scan, NumberSize size)
 {
     value = 0;
+    from_input = false;
     scan = scan_whitespace_or_comment(scan);
     if (is_name_start(*scan)) {
         auto start = scan++;
-        while (*scan && is_name_char(*scan)) {
+        while (is_name_char(*scan)) {
             ++scan;
         }
-        std::string var{start, scan};
-        if ((NumberSize::FourteenBit == size) && (0 == var.compare("zero"))) {
+        size_t length = scan - start;
+        if ((NumberSize::FourteenBit == size) && name_is(start, length, "zero")) {
             value = Haken::zero14;
         } else {
-            auto it = variables.find(var);
-            if (it == variables.end()) {
-                error(format_string("Undefined variable %s", var.c_str()), scan);
+            auto symbol = find_variable(start, length);
+            if (!symbol) {
+                if (name_is(start, length, INPUT_VARIABLE)) {
+                    from_input = true;
+                } else {
+                    error(format_string("Undefined variable %s", std::string(start, length).c_str()), scan);
+                }
             } else {
-                value = it->second;
+                value = symbol->value;
                 if (!valid_number(value, size)) {
-                    error(format_string("Variable %s value %d out of range for %s", var.c_str(), value, bitness(size)), scan);
+                    error(format_string("Variable %s value %d out of range for %s", symbol->name.c_str(), value, bitness(size)), scan);
                     value = 0;
                 }
             }
@@ -351,7 +370,7 @@ const char *scan_fraction(const char * scan, double* result)
     double place = 0.1;
     double f = 0;
     while (*scan) {
-        if (std::isdigit(*scan)) {
+        if (is_digit(*scan)) {
             f += place * (*scan - '0');
             place *= 0.1;
             ++scan;
@@ -368,6 +387,7 @@ const char *scan_fraction(const char * scan, double* result)
 const char *HclCompiler::scan_rational(const char *scan)
 {
     double f_value{NAN};
+    bool valid{true};
     switch (*scan) {
         case '-':
             ++scan;
@@ -376,6 +396,7 @@ const char *HclCompiler::scan_rational(const char *scan)
                 return scan + 1;
             } else {
                 scan = scan_fraction(scan, &f_value);
+                f_value = -f_value;
             }
             break;
 
@@ -395,15 +416,16 @@ const char *HclCompiler::scan_rational(const char *scan)
             break;
 
         default:
-            ok = false;
+            valid = false;
             break;
     }
     if (std::isnan(f_value)) {
-        ok = false;
+        valid = false;
     }
-    if (ok) {
+    if (valid) {
         f_value = std::round((f_value / inv_zero14) + Haken::zero14);
-        value = f_value;
+        // fractions near 1 round past the +1 value, which is the largest the encoding carries
+        value = std::max(0.0, std::min(f_value, double(Haken::max14)));
     } else {
         error("Expected -1 .. 1 value", scan);
     }
@@ -423,7 +445,7 @@ const char * HclCompiler::scan_variable_def(const char *scan)
 
         case ';': ++scan; break;
 
-        case ' ': case '\t': case '\r': case '\n':
+        case ' ': case '\t': case '\r': case '\n': case '\v': case '\f':
             scan = scan_whitespace(scan);
             break;
 
@@ -434,16 +456,9 @@ const char * HclCompiler::scan_variable_def(const char *scan)
             }
             name_end = scan;
             scan = scan_number(++scan, NumberSize::FourteenBit);
-            if (ok) {
-                auto key = std::string(name_start, name_end);
-                auto it = variables.lower_bound(key);
-                if (it == variables.end()) {
-                    variables.insert(std::make_pair(key, value));
-                } else {
-                    it->second = value;
-                }
-                name_start = name_end = nullptr;
-            }
+            if (!ok) return scan;
+            set_variable(name_start, name_end - name_start, value);
+            name_start = name_end = nullptr;
             break;
 
         default:
@@ -490,8 +505,7 @@ const char * HclCompiler::scan_cc(const char *scan)
         if (ok) {
             if (channel == Haken::ch16) {
                 if (value > 127) {
-                    ok = false;
-                    error_message = format_string("Not supported: 14-bit CC %d on channel 16", cc);
+                    error(format_string("Not supported: 14-bit CC %d on channel 16", cc), scan);
                     return scan;
                 }
             }
@@ -500,15 +514,17 @@ const char * HclCompiler::scan_cc(const char *scan)
                 if (channel == Haken::ch16) {
                     m = Tag(MakeCC(channel, cc, value), U8(ChemId::MidiPad));
                     dest->push_back(m);
+                    bind_input(dest->size() - 1, HclParam::Kind::Data2);
                 } else {
                     if (is_14bit_cc(cc)) {
-                        if (value > 127) {
+                        if (value > 127 || from_input) {
                             uint8_t lo = value & 0x7f;
                             uint8_t hi = value >> 7;
                             m = Tag(MakeCC(channel, Haken::ccFracIM48, lo), U8(ChemId::MidiPad));
                             dest->push_back(m);
                             m = Tag(MakeCC(channel, cc, hi), U8(ChemId::MidiPad));
                             dest->push_back(m);
+                            bind_input(dest->size() - 2, HclParam::Kind::Pair14);
                         } else {
                             m = Tag(MakeCC(channel, Haken::ccFracIM48, 0), U8(ChemId::MidiPad));
                             dest->push_back(m);
@@ -519,9 +535,9 @@ const char * HclCompiler::scan_cc(const char *scan)
                         if (value <= 127) {
                             m = Tag(MakeCC(channel, cc, value), U8(ChemId::MidiPad));
                             dest->push_back(m);
+                            bind_input(dest->size() - 1, HclParam::Kind::Data2);
                         } else {
-                            ok = false;
-                            error_message = format_string("%d out of range for 7-bit cc %d", value, cc);
+                            error(format_string("%d out of range for 7-bit cc %d", value, cc), scan);
                         }
                     }
                 }
@@ -535,7 +551,7 @@ const char *HclCompiler::scan_pc(const char *scan)
 {
     scan = scan_whitespace_or_comment(scan);
     scan = scan_number(scan, NumberSize::SevenBit);
-    if (ok) {
+    if (ok && dest) {
         uint8_t pc = value;
         auto m = Tag(MakeProgramChange(channel, pc), U8(ChemId::MidiPad));
         dest->push_back(m);
@@ -549,19 +565,18 @@ const char *HclCompiler::scan_macro(const char *scan)
     scan = scan_number(scan, NumberSize::SevenBit);
     if (ok) {
         if (!in_range(int(value), 1, 90)) {
-            ok = false;
             error(format_string("Macro # %d is out of range. Expected 1 .. 90)", value), scan);
             return scan;
         }
         uint8_t macro_number = value;
         scan = scan_whitespace_or_comment(scan);
         scan = scan_var_number(scan, NumberSize::FourteenBit);
-        if (ok) {
+        if (ok && dest) {
             uint8_t lo = value & 0x7f;
             uint8_t hi = value >> 7;
 
             uint8_t ccFrac = macro_number < 49 ? Haken::ccFracIM48 : Haken::ccFracM49M90;
-            bool omit_lo = (0 == lo) && (macro_number < 7);
+            bool omit_lo = (0 == lo) && (macro_number < 7) && !from_input;
             if (!omit_lo) {
                 auto m = Tag(MakeCC(channel, ccFrac, lo), U8(ChemId::MidiPad));
                 dest->push_back(m);
@@ -570,6 +585,7 @@ const char *HclCompiler::scan_macro(const char *scan)
             auto cc = macro_cc(macro_number);
             auto m = Tag(MakeCC(channel, cc, hi), U8(ChemId::MidiPad));
             dest->push_back(m);
+            bind_input(dest->size() - 2, HclParam::Kind::Pair14);
         }
     }
     return scan;
@@ -577,11 +593,14 @@ const char *HclCompiler::scan_macro(const char *scan)
 
 const char * HclCompiler::scan_stream(const char *scan)
 {
+    scan = scan_whitespace_or_comment(scan);
     scan = scan_number(scan, NumberSize::SevenBit);
     if (ok) {
         if (in_range(int(value), 0, 27)) {
-            auto m = Tag(MakeCC(Haken::ch16, Haken::ccStream, value), U8(ChemId::MidiPad));
-            dest->push_back(m);
+            if (dest) {
+                auto m = Tag(MakeCC(Haken::ch16, Haken::ccStream, value), U8(ChemId::MidiPad));
+                dest->push_back(m);
+            }
             scan = scan_list(scan);
         } else {
             error(format_string("Invalid stream id %d", value), scan);
@@ -610,10 +629,19 @@ const char *HclCompiler::scan_graph(const char *scan)
 const char *HclCompiler::scan_poke(const char *scan, uint8_t poke_stream)
 {
     if (dest) {
-        auto m = Tag(MakeCC(Haken::ch16, Haken::ccStream, poke_stream), U8(ChemId::MidiPad));
-        dest->push_back(m);
+        // Pokes need no end of stream, so consecutive pokes to the same stream share the header.
+        bool open = (poke_open == poke_stream) && (poke_end == dest->size());
+        if (!open) {
+            auto m = Tag(MakeCC(Haken::ch16, Haken::ccStream, poke_stream), U8(ChemId::MidiPad));
+            dest->push_back(m);
+        }
+    }
+    scan = scan_list(scan);
+    if (dest && ok) {
+        poke_open = poke_stream;
+        poke_end = dest->size();
     }
-    return scan_list(scan);
+    return scan;
 }
 
 const char * HclCompiler::scan_list(const char *scan)
@@ -628,11 +656,15 @@ const char * HclCompiler::scan_list(const char *scan)
 
     uint16_t first;
     uint16_t second;
+    bool first_input;
+    bool second_input;
     while (*scan && (']' != *scan) && ok) {
         first = second = 0;
+        second_input = false;
         scan = scan_var_number(scan, NumberSize::SevenBit);
         if (ok) {
             first = value;
+            first_input = from_input;
             scan = scan_whitespace_or_comment(scan);
             if (']' == *scan) {
                     // unpaired
@@ -642,18 +674,24 @@ const char * HclCompiler::scan_list(const char *scan)
             } else {
                 scan = scan_var_number(scan, NumberSize::SevenBit);
                 second = value;
+                second_input = from_input;
             }
             if (ok) {
                 if (dest) {
                     auto m = Tag(MakePolyKeyPressure(Haken::ch16, first, second), U8(ChemId::MidiPad));
                     dest->push_back(m);
+                    from_input = first_input;
+                    bind_input(dest->size() - 1, HclParam::Kind::Data1);
+                    from_input = second_input;
+                    bind_input(dest->size() - 1, HclParam::Kind::Data2);
                 }
             } else {
                 return scan;
             }
         }
     }
-    if (ok && *scan != ']') {
+    if (!ok) return scan;
+    if (*scan != ']') {
         error("Expected list end: ']'", scan);
         return scan;
     }
@@ -682,34 +720,89 @@ const char * HclCompiler::parse_opcode(const char *scan)
     return scan;
 }
 
+void HclCompiler::bind_input(size_t index, HclParam::Kind kind)
+{
+    if (from_input && params) {
+        params->push_back(HclParam{static_cast<uint16_t>(index), kind});
+    }
+}
+
 void HclCompiler::error(const std::string& error, const char *pos)
 {
     ok = false;
-    error_message = error;
-    error_pos = pos - program_start;
+    int at = pos - program_start;
+    if (errors.empty()) {
+        error_message = error;
+        error_pos = at;
+    }
+    if (errors.size() < MAX_ERRORS) {
+        errors.push_back(HclError{at, error});
+    }
+}
+
+const HclSymbol* HclCompiler::find_variable(const char* name, size_t length) const
+{
+    for (auto& symbol: variables) {
+        if (name_is(name, length, symbol.name.c_str())) return &symbol;
+    }
+    return nullptr;
 }
 
-bool HclCompiler::compile(const std::string &program, std::vector<PackedMidiMessage> *midi)
+void HclCompiler::set_variable(const char* name, size_t length, uint16_t value)
+{
+    for (auto& symbol: variables) {
+        if (name_is(name, length, symbol.name.c_str())) {
+            symbol.value = value;
+            return;
+        }
+    }
+    variables.push_back(HclSymbol{std::string(name, length), value});
+}
+
+// Skip the rest of the statement in error, to the next variable definition or opcode.
+const char * HclCompiler::recover(const char *scan)
+{
+    while (*scan) {
+        while (*scan && !is_space(*scan) && ('"' != *scan)) {
+            ++scan;
+        }
+        scan = scan_whitespace_or_comment(scan);
+        if (('{' == *scan) || get_valid_opcode(scan).nom()) break;
+    }
+    return scan;
+}
+
+bool HclCompiler::compile(const std::string &program, std::vector<PackedMidiMessage> *midi, std::vector<HclParam>* input_params)
 {
     dest = midi;
     if (dest) dest->clear();
+    params = dest ? input_params : nullptr;
+    if (params) params->clear();
+    PerfScope perf(perf_hcl_compile);
     program_start = program.c_str();
     const char * scan = program_start;
     if (program.empty()) {
         error("Midi definition is empty.", scan);
         return false;
     }
-    while (ok && *scan) {
+    // Each statement starts clean, so one pass reports every statement in error.
+    while (*scan && (errors.size() < MAX_ERRORS)) {
         scan = scan_whitespace_or_comment(scan);
+        if (!*scan) break;
+        ok = true;
         if ('{' == *scan) {
             scan = scan_variable_def(scan);
-        } else if (*scan) {
+        } else {
             scan = scan_opcode(scan);
             if (ok) {
                 scan = parse_opcode(scan);
             }
         }
+        if (!ok) {
+            scan = recover(scan);
+        }
     }
+    ok = errors.empty();
     // if (dest && dest->empty()) {
     //     error("Compilation produced no MIDI messages", scan);
     // }
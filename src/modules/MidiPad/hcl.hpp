@@ -41,22 +41,63 @@ enum class NumberSize
     FourteenBit = Haken::max14
 };
 
+// A value in a compiled program that is supplied at trigger time by the pad's input,
+// as the index of the message carrying it in the compiled messages.
+struct HclParam
+{
+    enum class Kind : uint8_t {
+        Data1,  // 7-bit value in data1
+        Data2,  // 7-bit value in data2
+        Pair14  // 14-bit value: lo in data2 of [index], hi in data2 of [index + 1]
+    };
+    uint16_t index;
+    Kind kind;
+};
+
+// Variables are few per program, so a flat table searched in definition order.
+struct HclSymbol
+{
+    std::string name;
+    uint16_t value;
+};
+
+struct HclError
+{
+    int pos;
+    std::string message;
+};
+
+// Variable name for the pad input's value
+const char * const INPUT_VARIABLE = "input";
+
 struct HclCompiler
 {
     bool ok{true};
-    int error_pos{0};
-    std::string error_message;
+    int error_pos{0};           // first error
+    std::string error_message;  // first error
+    static const size_t MAX_ERRORS = 16;
+    std::vector<HclError> errors;
     const char * program_start;
 
     uint8_t channel{0};
     uint16_t value;
     Opcode code;
-    std::map<std::string, uint16_t> variables;
+    std::vector<HclSymbol> variables;
+    bool from_input{false}; // last scanned value is the pad input
+
+    // open poke stream, for merging consecutive pokes to the same stream under one header
+    uint8_t poke_open{0xff};
+    size_t poke_end{0};
 
     void error(const std::string& error, const char * pos);
+    const char * recover(const char *scan);
+    const HclSymbol* find_variable(const char* name, size_t length) const;
+    void set_variable(const char* name, size_t length, uint16_t value);
 
     std::vector<PackedMidiMessage>* dest{nullptr};
-    bool compile(const std::string& program, std::vector<PackedMidiMessage>* midi);
+    std::vector<HclParam>* params{nullptr};
+    bool compile(const std::string& program, std::vector<PackedMidiMessage>* midi, std::vector<HclParam>* input_params = nullptr);
+    void bind_input(size_t index, HclParam::Kind kind);
     const char * parse_opcode(const char *scan);
     const char * scan_opcode(const char *scan);
     const char * scan_variable_def(const char *scan);
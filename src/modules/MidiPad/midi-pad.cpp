@@ -2,6 +2,7 @@
 #include "services/misc.hpp"
 #include "services/colors.hpp"
 #include "services/json-help.hpp"
+#include "services/rack-em-convert.hpp"
 #include "hcl.hpp"
 
 namespace pachde {
@@ -25,17 +26,48 @@ MidiPad::MidiPad(json_t *j) : error_pos(0) {
 
 bool MidiPad::compile() {
     HclCompiler hc;
-    ok = hc.compile(this->def, &this->midi);
+    ok = hc.compile(this->def, &this->midi, &this->params);
     if (ok) {
         error_message = "";
+        error_list = "";
         error_pos = 0;
     } else {
         error_message = hc.error_message;
         error_pos = hc.error_pos;
+        error_list.clear();
+        for (auto& error: hc.errors) {
+            if (!error_list.empty()) error_list.push_back('\n');
+            error_list.append(format_string("%d: %s", error.pos + 1, error.message.c_str()));
+        }
     }
     return ok;
 }
 
+void MidiPad::append_plan(std::vector<PackedMidiMessage>& out, float input)
+{
+    size_t base = out.size();
+    out.insert(out.end(), midi.cbegin(), midi.cend());
+    if (params.empty()) return;
+
+    uint8_t value7 = unipolar_rack_to_unipolar_7(input);
+    uint16_t value14 = unipolar_rack_to_unipolar_14(input);
+    for (auto param: params) {
+        auto& m = out[base + param.index];
+        switch (param.kind) {
+        case HclParam::Kind::Data1:
+            m.bytes.data1 = value7;
+            break;
+        case HclParam::Kind::Data2:
+            m.bytes.data2 = value7;
+            break;
+        case HclParam::Kind::Pair14:
+            m.bytes.data2 = value14 & 0x7f;
+            out[base + param.index + 1].bytes.data2 = value14 >> 7;
+            break;
+        }
+    }
+}
+
 json_t * MidiPad::to_json() {
     json_t * root = json_object();
     set_json_int(root, "pad", id);
@@ -113,7 +145,7 @@ void PadWidget::on_pad_change(bool name, bool description) {
                 }
             } else {
                 desc.push_back('\n');
-                desc.append(pad->error_message);
+                desc.append(pad->error_list);
             }
             describe(desc);
         }
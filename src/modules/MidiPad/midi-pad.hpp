@@ -6,6 +6,7 @@ using namespace ::rack;
 #include "widgets/element-style.hpp"
 #include "widgets/label.hpp"
 #include "widgets/tip-widget.hpp"
+#include "hcl.hpp"
 using namespace ::svg_theme;
 using namespace ::widgetry;
 
@@ -23,8 +24,11 @@ struct MidiPad
     PackedColor text_color;
     std::string name;
     std::string def;
+    // Transmit plan: the compiled messages in send order, and the slots filled from the pad input
     std::vector<PackedMidiMessage> midi;
-    std::string error_message;
+    std::vector<HclParam> params;
+    std::string error_message; // first error
+    std::string error_list;    // all errors, one per line
     int error_pos;
 
     MidiPad(int id);
@@ -32,6 +36,9 @@ struct MidiPad
 
     bool compile();
     bool defined() { return ok && !midi.empty(); }
+    bool parameterized() { return !params.empty(); }
+    // Append the plan to `out`, with the input voltage (0-10V) filled in
+    void append_plan(std::vector<PackedMidiMessage>& out, float input);
     bool empty() {
         if (-1 == id) return true;
         if (def.empty()) {
@@ -41,8 +48,10 @@ struct MidiPad
     }
     void clear() {
         midi.clear();
+        params.clear();
         def.clear();
         error_message.clear();
+        error_list.clear();
         name = id >= 0 ? default_pad_name[id]: "";
         error_pos = 0;
     }
@@ -119,6 +119,8 @@ PlayUi::PlayUi(PlayModule *module) :
         addChild(createThemedWidget<ThemeScrew>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH), &module_svgs));
     }
 
+    // drawn into a framebuffer, redrawn when a preset widget changes
+    preset_layer = new CachedLayer;
     float y = PRESETS_TOP;
     for (int i = 0; i < PAGE_CAPACITY; ++i) {
         auto pw = createPresetWidget(this, &presets, PRESETS_LEFT, y);
@@ -126,9 +128,17 @@ PlayUi::PlayUi(PlayModule *module) :
             pw->set_text(in_range(i, 4, 14) ? "..." : format_string("[preset #%d]", 1 + i));
         }
         preset_widgets.push_back(pw);
-        addChild(pw);
-        y += 20;
+        preset_layer->add(pw);
+        y += ROW_HEIGHT;
     }
+    preset_layer->fit(Vec(8.f, 0.f));
+    rows_top = preset_widgets[0]->box.pos.y;
+    // below the page, in view only while scrolling between rows
+    spare_row = preset_layer->add(createPresetWidget(this, &presets, preset_widgets[0]->box.pos.x, rows_top + PAGE_CAPACITY * ROW_HEIGHT));
+    spare_row->setVisible(false);
+    // rows scrolled partly out of the list are cut off at its edges
+    preset_layer->set_clip(math::Rect(0.f, PRESETS_TOP, box.size.x, PAGE_CAPACITY * ROW_HEIGHT));
+    addChild(preset_layer);
     haken_device_label = createLabel<TipLabel>(Vec(28.f, box.size.y - 13.f), S::NotConnected, &S::haken_label, 200.f);
     addChild(haken_device_label);
 
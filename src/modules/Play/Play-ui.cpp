@@ -97,7 +97,8 @@ void PlayUi::add_live() {
         return live_preset->id == p->id;
     });
     if (it == presets.cend()) {
-        presets.push_back(live_preset);
+        // the live preset is shared with other modules: the playlist gets its own copy
+        presets.push_back(std::make_shared<PresetInfo>(*live_preset));
         set_modified(true);
         page_down(true, false);
     } else {
@@ -151,6 +152,7 @@ void PlayUi::widgets_clear_current() {
     for(auto wit = preset_widgets.begin(); wit != preset_widgets.end(); wit++) {
         (*wit)->set_current(false);
     }
+    if (spare_row) spare_row->set_current(false);
 }
 
 void PlayUi::prev_preset() {
@@ -203,10 +205,7 @@ void PlayUi::onConnectHost(IChemHost* host) {
 }
 
 bool PlayUi::is_visible(ssize_t index) {
-    auto it = std::find_if(preset_widgets.begin(), preset_widgets.end(), [index](PresetWidget* pw) {
-        return static_cast<ssize_t>(pw->get_index()) == index;
-    });
-    return it != preset_widgets.cend();
+    return (index >= scroll_top) && (index < scroll_top + PAGE_CAPACITY) && (index < preset_count());
 }
 
 void PlayUi::update_live() {
@@ -215,10 +214,12 @@ void PlayUi::update_live() {
             if (pw->empty()) break;
             pw->set_live(pw->get_preset_id() == live_preset->id);
         }
+        if (spare_row && !spare_row->empty()) spare_row->set_live(spare_row->get_preset_id() == live_preset->id);
     } else {
         for (auto pw : preset_widgets) {
             pw->set_live(false);
         }
+        if (spare_row) spare_row->set_live(false);
     }
 }
 
@@ -257,34 +258,73 @@ void PlayUi::page_down(bool ctrl, bool shift) {
 
 void PlayUi::scroll_to(ssize_t pos) {
     assert(pos >= SSIZE_0);
+    scroll_px = scroll_target = pos * ROW_HEIGHT;
+    bind_rows(pos);
+    place_rows();
+}
+
+void PlayUi::scroll_by(float rows) {
+    float last = std::max(0.f, float(preset_count() - PAGE_CAPACITY)) * ROW_HEIGHT;
+    scroll_target = clamp(scroll_target + rows * ROW_HEIGHT, 0.f, last);
+}
 
+void PlayUi::bind_rows(ssize_t pos) {
     scroll_top = pos;
     auto live_id = get_live_id();
-    auto sit = selected.cbegin();
+    auto sit = std::lower_bound(selected.cbegin(), selected.cend(), pos);
 
-    auto pit = presets.cbegin() + pos;
-    for (auto pw : preset_widgets) {
+    auto pit = (pos < preset_count()) ? presets.cbegin() + pos : presets.cend();
+    auto bind = [&](PresetWidget* pw) {
         pw->clear_states();
         if (pit != presets.cend()) {
             pw->set_preset(pos, current_index == pos, live_id == (*pit)->id, *pit);
 
-            if (sit != selected.cend()) {
-                bool is_selected = (pos == *sit);
-                pw->set_selected(is_selected);
-                if (is_selected) sit++;
-            } else {
-                pw->set_selected(false);
-            }
+            bool is_selected = (sit != selected.cend()) && (pos == *sit);
+            pw->set_selected(is_selected);
+            if (is_selected) sit++;
 
             ++pos;
             pit++;
         } else {
             pw->clear_preset();
         }
+    };
+    for (auto pw : preset_widgets) {
+        bind(pw);
     }
+    if (spare_row) bind(spare_row);
     update_up_down();
 }
 
+void PlayUi::place_rows() {
+    float offset = scroll_px - scroll_top * ROW_HEIGHT;
+    if (offset == placed_offset) return;
+    placed_offset = offset;
+    float y = rows_top - offset;
+    for (auto pw : preset_widgets) {
+        pw->box.pos.y = y;
+        y += ROW_HEIGHT;
+    }
+    if (spare_row) {
+        spare_row->box.pos.y = y;
+        spare_row->setVisible(offset != 0.f);
+    }
+    if (preset_layer) preset_layer->setDirty();
+}
+
+void PlayUi::step_scroll() {
+    // come to rest on a whole row
+    float destination = std::round(scroll_target / ROW_HEIGHT) * ROW_HEIGHT;
+    if (scroll_px == destination) return;
+    float distance = destination - scroll_px;
+    scroll_px = (std::fabs(distance) < .5f) ? destination : scroll_px + distance * .35f;
+    ssize_t row = static_cast<ssize_t>(scroll_px / ROW_HEIGHT);
+    if (row != scroll_top) {
+        bind_rows(row);
+    }
+    place_rows();
+}
+
 void PlayUi::make_visible(ssize_t index) {
     scroll_to_page_of_index(index);
 }
@@ -477,10 +517,10 @@ void PlayUi::onPresetChange() {
 
     if (chem_host) {
         if (chem_host->host_busy()) return;
-        auto preset = chem_host->host_preset();
+        auto snapshot = chem_host->host_preset_snapshot();
+        auto preset = snapshot ? snapshot->preset.get() : nullptr;
         if (preset) {
-            live_preset = std::make_shared<PresetInfo>();
-            live_preset->init(preset);
+            live_preset = snapshot->preset;
             auto index = index_of_id(preset->id);
             if (index >= 0) {
                 auto p = presets[index];
@@ -697,8 +737,10 @@ void PlayUi::onChoosePreset(PresetWidget* source) {
 }
 
 PresetWidget* PlayUi::getDropTarget(Vec pos) {
-    if ((pos.y < PRESETS_TOP) || (pos.y > PRESETS_TOP + 314.f)) return nullptr;
-    if ((pos.x < PRESETS_LEFT) || (pos.x > PRESETS_LEFT + 150.f)) return nullptr;
+    // pos is in the preset layer
+    Vec panel_pos = preset_layer ? pos.plus(preset_layer->box.pos) : pos;
+    if ((panel_pos.y < PRESETS_TOP) || (panel_pos.y > PRESETS_TOP + 314.f)) return nullptr;
+    if ((panel_pos.x < PRESETS_LEFT) || (panel_pos.x > PRESETS_LEFT + 150.f)) return nullptr;
     for (auto pw : preset_widgets) {
         if (pw->box.contains(pos)) {
             return pw;
@@ -869,27 +911,50 @@ void PlayUi::onSelectKey(const SelectKeyEvent &e) {
 
 void PlayUi::onHoverScroll(const HoverScrollEvent &e) {
     if (in_rangef(e.pos.x, PRESETS_LEFT, PRESETS_LEFT + 150.f) && in_rangef(e.pos.y, PRESETS_TOP, 340.f)) {
-        int delta = 5 * ((e.scrollDelta.y < 0) ? 1 : (e.scrollDelta.y > 0) ? -1 : 0);
+        // a wheel notch (50) scrolls 5 rows, and trackpads scroll by the pixel
+        float rows = -e.scrollDelta.y / 10.f;
         auto mods = APP->window->getMods();
         if (mods & GLFW_MOD_CONTROL) {
-            delta *= 3.f;
+            rows *= 3.f;
         }
-        ssize_t index = scroll_top + delta;
-        if (index > ssize_t(presets.size()) - PAGE_CAPACITY) index = presets.size() - PAGE_CAPACITY;
-        if (index < 0) index = 0;
-        scroll_to(index);
+        scroll_by(rows);
         e.consume(this);
         return;
     }
     Base::onHoverScroll(e);
 }
 
+void PlayUi::apply_module_commands() {
+    my_module->ui_preset_count.store(preset_count(), std::memory_order_relaxed);
+
+    PlayModule::PlayCommand command;
+    while (my_module->ui_commands.next(command)) {
+        switch (command.intent) {
+        case PlayModule::PlayIntent::Select:
+            if (command.index < preset_count()) {
+                select_index(command.index);
+            }
+            break;
+        case PlayModule::PlayIntent::Next:
+            next_preset();
+            break;
+        case PlayModule::PlayIntent::Prev:
+            prev_preset();
+            break;
+        }
+    }
+}
+
 void PlayUi::step() {
     Base::step();
     bind_host(my_module);
+    if (my_module) {
+        apply_module_commands();
+    }
 
     if (pending_device_check) {
         check_playlist_device();
     }
+    step_scroll();
 }
 
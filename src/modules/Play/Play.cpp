@@ -108,6 +108,7 @@ void PlayModule::onPortChange(const PortChangeEvent &e) {
 }
 
 void PlayModule::process(const ProcessArgs& args) {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
 
     if (!host_connected(chem_host) || chem_host->host_busy() || !chem_ui) return;
@@ -117,13 +118,14 @@ void PlayModule::process(const ProcessArgs& args) {
     }
     if (!throttle_preset.running()) {
         bool preset_sent{false};
-        if (ui()->preset_count()) {
+        auto count = ui_preset_count.load(std::memory_order_relaxed);
+        if (count) {
             auto select_in = getInput(Inputs::IN_PRESET_SELECT);
             if (select_in.isConnected()) {
-                int lim = std::min(16, int(ui()->preset_count()));
+                int lim = std::min(16, int(count));
                 for (int i = 0; i < lim; ++i) {
                     if (select_triggers[i].process(select_in.getVoltage(i), 0.1f, 5.f)) {
-                        ui()->select_index(i);
+                        ui_commands.post(PlayCommand{PlayIntent::Select, uint8_t(i)});
                         preset_sent = true;
                         throttle_preset.start(4);
                         break;
@@ -136,7 +138,7 @@ void PlayModule::process(const ProcessArgs& args) {
                 auto v = next_in.getVoltage();
                 if (next_trigger.process(v, 0.1f, 5.f)) {
                     next_trigger.reset();
-                    ui()->next_preset();
+                    ui_commands.post(PlayCommand{PlayIntent::Next, 0});
                     preset_sent = true;
                     throttle_preset.start(4);
                 }
@@ -147,7 +149,7 @@ void PlayModule::process(const ProcessArgs& args) {
                 auto v = prev_in.getVoltage();
                 if (prev_trigger.process(v, 0.1f, 5.f)) {
                     prev_trigger.reset();
-                    ui()->prev_preset();
+                    ui_commands.post(PlayCommand{PlayIntent::Prev, 0});
                     preset_sent = true;
                     throttle_preset.start(4);
                 }
@@ -6,6 +6,7 @@
 #include "services/colors.hpp"
 #include "services/kv-store.hpp"
 #include "services/ModuleBroker.hpp"
+#include "services/ui-queue.hpp"
 #include "widgets/blip-widget.hpp"
 #include "widgets/theme-button.hpp"
 #include "widgets/draw-button.hpp"
@@ -44,6 +45,15 @@ struct PlayModule : ChemModule, IChemClient
     rack::dsp::SchmittTrigger select_triggers[16];
     WallTimer throttle_preset;
 
+    // preset selection from the CV inputs, applied by the UI
+    enum class PlayIntent : uint8_t { Select, Next, Prev };
+    struct PlayCommand {
+        PlayIntent intent;
+        uint8_t index;
+    };
+    UiQueue<PlayCommand> ui_commands;
+    std::atomic<ssize_t> ui_preset_count{0}; // published by the UI
+
     std::string playlist_folder;
     std::string playlist_file;
     std::deque<std::string> playlist_mru;
@@ -82,6 +92,7 @@ struct PlayModule : ChemModule, IChemClient
 enum class FillOptions { None, User, System, All, Blanks };
 struct PlayMenu;
 constexpr const int PAGE_CAPACITY = 15;
+constexpr const float ROW_HEIGHT = 20.f;
 
 struct PlayUi : ChemModuleWidget, IChemClient, IPresetAction
 {
@@ -110,7 +121,7 @@ struct PlayUi : ChemModuleWidget, IChemClient, IPresetAction
         blip->set_brightness(modified ? 1.f : 0.f);
     }
 
-    std::shared_ptr<PresetInfo> live_preset;
+    std::shared_ptr<const PresetInfo> live_preset;
     PresetId get_live_id() { PresetId id; return live_preset ? live_preset->id : id; }
     std::shared_ptr<PresetInfo> current_preset;
     ssize_t current_index{-1};
@@ -121,6 +132,17 @@ struct PlayUi : ChemModuleWidget, IChemClient, IPresetAction
     std::vector<PresetWidget*> preset_widgets;
     ssize_t scroll_top{0};  // index of top preset
 
+    // Smooth scrolling.
+    // The list scrolls by pixels toward scroll_target (row * ROW_HEIGHT), easing in step().
+    // The page of widgets is recycled: shifted up by the fraction of a row scrolled,
+    // with the spare row showing below, and re-bound only when the top row changes.
+    CachedLayer* preset_layer{nullptr};
+    PresetWidget* spare_row{nullptr};
+    float rows_top{0.f};
+    float scroll_px{0.f};
+    float scroll_target{0.f};
+    float placed_offset{0.f};
+
     std::string playlist_name;
     std::string playlist_device;
 
@@ -156,6 +178,10 @@ struct PlayUi : ChemModuleWidget, IChemClient, IPresetAction
     void page_down(bool ctrl, bool shift);
     void make_visible(ssize_t index);
     void scroll_to(ssize_t index);
+    void scroll_by(float rows);
+    void bind_rows(ssize_t index);
+    void place_rows();
+    void step_scroll();
     void scroll_to_live();
     void scroll_to_page_of_index(ssize_t index);
     ssize_t page_index_of_index(ssize_t index);
@@ -164,6 +190,7 @@ struct PlayUi : ChemModuleWidget, IChemClient, IPresetAction
     void add_live();
     void prev_preset();
     void next_preset();
+    void apply_module_commands();
     void open_playlist();
     void close_playlist();
     void save_playlist();
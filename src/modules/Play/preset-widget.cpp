@@ -58,6 +58,25 @@ void PresetWidget::applyTheme(std::shared_ptr<SvgTheme> theme) {
     hover_element.apply_theme(theme);
 }
 
+uint64_t PresetWidget::draw_signature()
+{
+    uint64_t sig = std::hash<std::string>{}(preset_name);
+    sig = hash_mix(sig, preset_id.key());
+    sig = hash_mix(sig, static_cast<uint64_t>(preset_index));
+    sig = hash_mix(sig, reinterpret_cast<uintptr_t>(drop_target));
+    sig = hash_mix(sig,
+          (live ? 1 : 0)
+        | (selected ? 2 : 0)
+        | (current ? 4 : 0)
+        | (hovered ? 8 : 0)
+        | (hover_grip ? 16 : 0)
+        | (button_down ? 32 : 0)
+        | (dragging ? 64 : 0)
+        // draw() renders only at full brightness: the dimmed rendering is in drawLayer
+        | ((rack::settings::rackBrightness >= .95f) ? 128 : 0));
+    return sig;
+}
+
 void PresetWidget::clear_preset()
 {
     preset_index = -1;
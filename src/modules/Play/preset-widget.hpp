@@ -4,6 +4,7 @@
 #include "widgets/element-style.hpp"
 #include "widgets/themed-widgets.hpp"
 #include "widgets/label.hpp"
+#include "widgets/cached-layer.hpp"
 
 using namespace ::rack;
 using namespace ::svg_theme;
@@ -28,7 +29,7 @@ struct IPresetAction {
     virtual Widget* widget() = 0;
 };
 
-class PresetWidget : public OpaqueWidget, public IThemed
+class PresetWidget : public OpaqueWidget, public IThemed, public ICachedDraw
 {
     using Base = OpaqueWidget;
 
@@ -91,6 +92,7 @@ public:
     void set_agent(IPresetAction* client) { agent = client; }
 
     void applyTheme(std::shared_ptr<SvgTheme> theme) override;
+    uint64_t draw_signature() override;
 
     void appendContextMenu(ui::Menu* menu);
     void createContextMenu()
@@ -36,8 +36,7 @@ PostUi::PostUi(PostModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     addChild(knobs[K_POST_LEVEL] = createChemKnob<YellowKnob>(bounds["k:level"].getCenter(), &module_svgs, module, PostModule::P_POST_LEVEL));
     addChild(tracks[K_POST_LEVEL] = createTrackWidget(knobs[K_POST_LEVEL]));
@@ -102,7 +101,7 @@ PostUi::PostUi(PostModule *module) :
     }
 }
 
-void PostUi::add_input(::svg_query::BoundsIndex &bounds, const char* port_key, const char* label_key, const char* click_key, const char* label, int index)
+void PostUi::add_input(const ::svg_query::BoundsIndex& bounds, const char* port_key, const char* label_key, const char* click_key, const char* label, int index)
 {
     Vec pos{bounds[port_key].getCenter()};
     addChild(Center(createThemedColorInput(pos, &module_svgs, my_module, index, S::InputColorKey, PORT_CORN)));
@@ -130,7 +129,7 @@ void PostUi::center_knobs() {
     }
 }
 
-void PostUi::add_knob(::svg_query::BoundsIndex &bounds, const char *knob_key, const char *label_key, const char *label, int index){
+void PostUi::add_knob(const ::svg_query::BoundsIndex& bounds, const char *knob_key, const char *label_key, const char *label, int index){
     addChild(knobs[index] = createChemKnob<BasicKnob>(bounds[knob_key].getCenter(), &module_svgs, module, index));
     addChild(tracks[index] = createTrackWidget(knobs[index]));
     addChild(createLabel(bounds[label_key], label, &S::control_label));
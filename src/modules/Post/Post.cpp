@@ -160,11 +160,13 @@ void PostModule::process_params(const ProcessArgs &args)
 
 void PostModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
+    bool sync_ready = modulation.sync_params_ready(args);
 
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
-    if (modulation.sync_params_ready(args)) {
+    if (sync_ready) {
         modulation.sync_send();
     }
 
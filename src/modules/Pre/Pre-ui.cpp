@@ -36,8 +36,7 @@ PreUi::PreUi(PreModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     bool browsing = !module;
 
@@ -108,6 +107,27 @@ PreUi::PreUi(PreModule *module) :
 
     addChild(haken_device_label = createLabel<TipLabel>(bounds["k:haken"], S::NotConnected, &S::haken_label));
 
+    // follow the panel on a hot-reload
+    using svg_query::HotPosKind;
+    hot_bounds = bounds;
+    svg_query::addPosition(hot_positions, "k:selector", HotPosKind::TopLeft, selector);
+    svg_query::addPosition(hot_positions, "k:level", HotPosKind::Center, knobs[K_PRE_LEVEL]);
+    svg_query::addPosition(hot_positions, "k:level", HotPosKind::Center, tracks[K_PRE_LEVEL]);
+    svg_query::addPosition(hot_positions, "k:mix", HotPosKind::Center, knobs[K_MIX]);
+    svg_query::addPosition(hot_positions, "k:mix", HotPosKind::Center, tracks[K_MIX]);
+    svg_query::addPosition(hot_positions, "k:mix-light", HotPosKind::Center, mix_light);
+    svg_query::addPosition(hot_positions, "k:thr", HotPosKind::Center, knobs[K_THRESH_DRIVE]);
+    svg_query::addPosition(hot_positions, "k:thr", HotPosKind::Center, tracks[K_THRESH_DRIVE]);
+    svg_query::addPosition(hot_positions, "k:thr-label", HotPosKind::Box, top_knob_label);
+    svg_query::addPosition(hot_positions, "k:att", HotPosKind::Center, knobs[K_ATTACK_X]);
+    svg_query::addPosition(hot_positions, "k:att", HotPosKind::Center, tracks[K_ATTACK_X]);
+    svg_query::addPosition(hot_positions, "k:att-label", HotPosKind::Box, mid_knob_label);
+    svg_query::addPosition(hot_positions, "k:rat", HotPosKind::Center, knobs[K_RATIO_MAKEUP]);
+    svg_query::addPosition(hot_positions, "k:rat", HotPosKind::Center, tracks[K_RATIO_MAKEUP]);
+    svg_query::addPosition(hot_positions, "k:rat-label", HotPosKind::Box, bot_knob_label);
+    svg_query::addPosition(hot_positions, "k:amount", HotPosKind::Center, knobs[K_MODULATION]);
+    svg_query::addPosition(hot_positions, "k:haken", HotPosKind::Box, haken_device_label);
+
     link_button = createThemedButton<LinkButton>(Vec(12.f, box.size.y - S::U1), &module_svgs, "Core link");
     if (my_module) {
         link_button->set_handler([=](bool ctrl, bool shift) {
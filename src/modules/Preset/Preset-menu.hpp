@@ -31,7 +31,7 @@ struct ActionsMenu : PresetMenu
         menu->addChild(createMenuLabel<HamburgerTitle>("Preset Actions"));
 
         Tab & tab = ui->active_tab();
-        PresetOrder order = tab.list.preset_list ? tab.list.preset_list->order : PresetOrder::Alpha;
+        PresetOrder order = tab.list.preset_list ? tab.list.get_order() : PresetOrder::Alpha;
 
         auto entry = new OptionMenuEntry(PresetOrder::Alpha == order,
             createMenuItem("Sort alphabetically", "", [=](){ ui->sort_presets(PresetOrder::Alpha); }));
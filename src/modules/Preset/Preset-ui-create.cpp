@@ -26,8 +26,7 @@ PresetUi::PresetUi(PresetModule *module) :
     auto panel = createThemedPanel(panelFilename(), &module_svgs);
     panelBorder = attachPartnerPanelBorder(panel);
     setPanel(panel);
-    ::svg_query::BoundsIndex bounds;
-    svg_query::addBounds(panel->svg, "k:", bounds, true);
+    const ::svg_query::BoundsIndex& bounds = svg_query::cachedBounds(panel->svg, "k:", true);
 
     search_entry = createThemedTextInput(bounds["k:search-edit"], "",
         [=](const std::string& text) { on_search_text_changed(text); },
@@ -122,10 +121,7 @@ PresetUi::PresetUi(PresetModule *module) :
 
     auto nav = createChemKnob<EndlessKnob>(bounds["k:nav-knob"].getCenter(), &module_svgs, my_module, PresetModule::P_NAV);
     nav->set_handler([=](){
-        Tab& tab = active_tab();
-        if ((tab.current_index >= 0) && host_available() && (tab.list.count() > 0)) {
-            chem_host->request_preset(ChemId::Preset, tab.list.nth(tab.current_index)->id);
-        }
+        send_preset(active_tab().current_index);
     });
     addChild(nav);
 
@@ -159,6 +155,8 @@ PresetUi::PresetUi(PresetModule *module) :
     if (my_module) {
         user_tab.list.init_filters(my_module->user_filters);
         system_tab.list.init_filters(my_module->system_filters);
+        user_tab.list.order = my_module->user_order;
+        system_tab.list.order = my_module->system_order;
         auto filters = my_module->filters();
         for (auto fb: filter_buttons) {
             fb->set_state(*filters++);
@@ -166,17 +164,21 @@ PresetUi::PresetUi(PresetModule *module) :
     }
 
     // preset grid
+    // drawn into a framebuffer, redrawn when an entry changes
+    auto grid_layer = new CachedLayer;
     float x = 9.f; float y = PRESET_TOP;
     for (int i = 0; i < PAGE_CAPACITY; ++i) {
         auto entry = PresetEntry::create(Vec(x,y), preset_grid, this);
         preset_grid.push_back(entry);
-        addChild(entry);
+        grid_layer->add(entry);
         y += 16.f;
         if (i == PAGE_CAPACITY/2 - 1) {
             x = 172;
             y = PRESET_TOP;
         }
     }
+    grid_layer->fit(6.f); // current marker and live box
+    addChild(grid_layer);
 
     addChild(help_label = createLabel<TextLabel>(bounds["k:help"], "", &help_style));
 
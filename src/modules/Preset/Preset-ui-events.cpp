@@ -54,9 +54,7 @@ void PresetUi::onSelectKey(const SelectKeyEvent &e)
 
         case GLFW_KEY_ENTER:
             if (0 == mods)  {
-                if ((tab.current_index >= 0) && host_available() && (tab.list.count() > 0)) {
-                    chem_host->request_preset(ChemId::Preset, tab.list.nth(tab.current_index)->id);
-                }
+                send_preset(tab.current_index);
             }
             e.consume(this);
             return;
@@ -181,12 +179,6 @@ void PresetUi::onHoverScroll(const HoverScrollEvent &e)
     Base::onHoverScroll(e);
 }
 
-void PresetUi::hot_reload() {
-    Base::hot_reload();
-    auto svg = module_svgs.loadSvg(panelFilename());
-    svg_query::hideElements(svg, "k:");
-}
-
 bool PresetUi::ready() {
     if (!chem_host) return false;
     if (start_delay.running()) return false;
@@ -213,6 +205,12 @@ void PresetUi::step() {
     if (filtering()) {
         filter_off_button->button_down = true;
     }
+    if (chem_host) {
+        auto pending = chem_host->host_pending_preset();
+        for (auto pw : preset_grid) {
+            pw->pending = pending.valid() && (pw->preset_id() == pending);
+        }
+    }
     if (my_module) {
         auto index = get_current_index();
         auto nav = my_module->get_nav_index();
@@ -286,5 +284,25 @@ void PresetUi::appendContextMenu(Menu *menu)
     //     [this](){ set_track_live(!my_module->track_live); }
     // ));
 
+    if (my_module) {
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createCheckMenuItem("Auto-repeat held MIDI prev/next", "",
+            [this](){ return my_module->preset_midi.repeat.enabled; },
+            [this](){
+                auto& repeat = my_module->preset_midi.repeat;
+                repeat.enabled = !repeat.enabled;
+                if (!repeat.enabled) my_module->preset_midi.stop_hold();
+            }
+        ));
+        menu->addChild(createSubmenuItem("Auto-repeat speed", repeat_speed_name(my_module->preset_midi.repeat.speed), [this](Menu* menu) {
+            for (int speed = 0; speed < NavRepeat::NumSpeeds; ++speed) {
+                menu->addChild(createCheckMenuItem(repeat_speed_name(speed), "",
+                    [this, speed](){ return speed == my_module->preset_midi.repeat.speed; },
+                    [this, speed](){ my_module->preset_midi.repeat.set_speed(speed); }
+                ));
+            }
+        }));
+    }
+
     Base::appendContextMenu(menu);
 }
@@ -42,6 +42,8 @@ bool PresetUi::load_presets(PresetTab which) {
     if (!pl) return false;
     Tab & tab = get_tab(which);
     tab.list.preset_list = (PresetTab::User == which) ? pl->host_user_presets() : pl->host_system_presets();
+    // the host may reload the same list in place, so rebuild the view even when the pointer is unchanged
+    tab.list.refresh_filter_view();
     return (nullptr != tab.list.preset_list) && !tab.list.preset_list->empty();
 }
 
@@ -57,8 +59,13 @@ void PresetUi::sort_presets(PresetOrder order) {
         current_id = tab.list.nth(tab.current_index)->id;
     }
 
+    // sorts this module's view: the host list is shared
     tab.list.sort(order);
-    tab.list.save();
+    if (PresetTab::User == tab.id()) {
+        my_module->user_order = order;
+    } else {
+        my_module->system_order = order;
+    }
 
     if (my_module->track_live) {
         scroll_to_live();
@@ -113,21 +120,17 @@ void PresetUi::onPresetChange() {
     if (other_user_gather || other_system_gather) return;
 
     if (chem_host) {
-        auto preset = chem_host->host_preset();
-        if (preset) {
-            live_preset = std::make_shared<PresetInfo>();
-            live_preset->init(preset);
+        auto snapshot = chem_host->host_preset_snapshot();
+        if (snapshot) {
+            auto preset = snapshot->preset.get();
+            live_preset = snapshot->preset;
             live_preset_label->set_text(preset->name);
-            live_preset_label->describe(live_preset->meta_text());
+            live_preset_label->describe(snapshot->meta_text);
             Tab& tab = active_tab();
-            auto n = tab.list.index_of_id(preset->id);
+            auto n = tab.list.use_view()
+                ? tab.list.index_of_id(preset->id)
+                : snapshot->index_in(tab.list.tab, tab.list.preset_list.get());
             if (n >= 0) {
-                auto p = tab.list.nth(n);
-                if (!preset_equal(preset, p.get()))
-                {
-                    p->init(preset);
-                    tab.list.set_dirty();
-                }
                 set_current_index(n);
             }
         } else {
@@ -335,10 +338,10 @@ void PresetUi::scroll_to(ssize_t index) {
     Tab& tab = active_tab();
     tab.scroll_top = index < 0 ? 0 : size_t(index);
     size_t ip = tab.scroll_top;
+    auto live_id = get_live_id();
     for (auto pw: preset_grid) {
         if (ip < tab.count()) {
             auto preset = tab.list.nth(ip);
-            auto live_id = get_live_id();
             bool live = live_id.valid() && (preset->id == live_id);
             pw->set_preset(ip, ssize_t(ip) == tab.current_index, live, preset);
         } else {
@@ -447,7 +450,8 @@ void PresetUi::send_preset(ssize_t index) {
     Tab& tab = active_tab();
     if (index >= ssize_t(tab.count())) return;
     auto preset = tab.list.nth(index);
-    if (preset && host_available()) {
+    // the host coalesces requests made while a preset is loading
+    if (preset && chem_host && chem_host->host_connection(ChemDevice::Haken)) {
         chem_host->request_preset(ChemId::Preset, preset->id);
     }
 }
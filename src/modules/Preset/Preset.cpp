@@ -17,6 +17,7 @@ PresetModule::PresetModule() :
     configSwitch(P_MUTE_KEY_NAV, 0.f, 1.f, 0.f, "Mute Keyboard nav", {"unmuted", "muted"});
     configButton(P_SELECT, "Select preset");
     preset_midi.init(this);
+    preset_midi.midi_in.register_perf(perf, "midi-in");
 }
 
 PresetModule::~PresetModule() {
@@ -79,6 +80,8 @@ void PresetModule::dataFromJson(json_t *root)
     last_nav = 0.f;
 #endif
     nav_include_loopback = get_json_bool(root, "nav-loopback", nav_include_loopback);
+    user_order = PresetOrder(get_json_int(root, "user-order", int(user_order)));
+    system_order = PresetOrder(get_json_int(root, "system-order", int(system_order)));
 
     if (keep_search_filters) {
         auto jar = json_object_get(root, "user-filters");
@@ -122,6 +125,8 @@ json_t* PresetModule::dataToJson()
     set_json_int(root, "nav-index", actual_nav_index);
 #endif
     set_json(root, "nav-loopback", nav_include_loopback);
+    set_json_int(root, "user-order", int(user_order));
+    set_json_int(root, "system-order", int(system_order));
 
     if (keep_search_filters) {
         auto jar = json_array();
@@ -188,9 +193,10 @@ void PresetModule::onRandomize()
 
 void PresetModule::process(const ProcessArgs &args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
 
-    if (chem_ui && ui()->ready() && !chem_host->host_busy()) {
+    if (chem_ui && ui()->ready()) {
         if (getParamInt(getParam(P_SELECT))) {
             ui()->send_preset(get_nav_index());
             getParam(P_SELECT).setValue(0);
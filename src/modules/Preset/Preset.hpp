@@ -60,6 +60,9 @@ struct PresetModule : ChemModule, IChemClient, INavigateList
     uint64_t user_filters[5]{0};
     uint64_t system_filters[5]{0};
     uint64_t* filters();
+    // sort order of each tab's view (None: the host list's order)
+    PresetOrder user_order{PresetOrder::None};
+    PresetOrder system_order{PresetOrder::None};
 
     bool track_live{false};
     bool keep_search_filters{true};
@@ -161,7 +164,7 @@ struct PresetUi : ChemModuleWidget, IChemClient, IHandleEmEvents, IPresetListCli
 
     WallTimer start_delay{3.5};
 
-    std::shared_ptr<PresetDescription> live_preset;
+    std::shared_ptr<const PresetInfo> live_preset;
 
     PresetTab active_tab_id{PresetTab::System};
     Tab user_tab {PresetTab::User};
@@ -236,7 +239,6 @@ struct PresetUi : ChemModuleWidget, IChemClient, IHandleEmEvents, IPresetListCli
     // ChemModuleWidget
     std::string panelFilename() override { return asset::plugin(pluginInstance, "res/panels/CHEM-preset.svg"); }
     void createScrews() override;
-    void hot_reload() override;
 
     // IPresetListClient
     void on_list_changed(eaganmatrix::PresetTab which) override;
@@ -46,6 +46,49 @@ json_t *CcControl::to_json() const {
 void CcControl::reset() {
     cc = last_value = base_value = UndefinedCode;
     kind = ControllerType::Unknown;
+    last_time = 0;
+}
+
+//
+// NavRepeat
+//
+
+const char * repeat_speed_name(int speed) {
+    switch (speed) {
+    case NavRepeat::Slow:   return "Slow";
+    case NavRepeat::Medium: return "Medium";
+    case NavRepeat::Fast:   return "Fast";
+    default: return "";
+    }
+}
+
+void NavRepeat::set_speed(int new_speed) {
+    speed = clamp(new_speed, 0, NavRepeat::NumSpeeds - 1);
+    switch (speed) {
+    case Slow:   interval = .25f; min_interval = .08f; acceleration = .9f; break;
+    default:
+    case Medium: interval = .15f; min_interval = .04f; acceleration = .85f; break;
+    case Fast:   interval = .1f;  min_interval = .02f; acceleration = .8f; break;
+    }
+}
+
+void NavRepeat::fromJson(json_t *root) {
+    enabled = get_json_bool(root, "nav-repeat", enabled);
+    set_speed(get_json_int(root, "repeat-speed", speed));
+    // optional fine tuning over the speed's settings
+    delay        = clamp(get_json_float(root, "repeat-delay", delay), .05f, 2.f);
+    interval     = clamp(get_json_float(root, "repeat-interval", interval), .01f, 1.f);
+    min_interval = clamp(get_json_float(root, "repeat-min-interval", min_interval), .01f, interval);
+    acceleration = clamp(get_json_float(root, "repeat-acceleration", acceleration), .5f, 1.f);
+}
+
+void NavRepeat::toJson(json_t *root) const {
+    set_json(root, "nav-repeat", enabled);
+    set_json_int(root, "repeat-speed", speed);
+    set_json(root, "repeat-delay", delay);
+    set_json(root, "repeat-interval", interval);
+    set_json(root, "repeat-min-interval", min_interval);
+    set_json(root, "repeat-acceleration", acceleration);
 }
 
 //
@@ -78,6 +121,7 @@ void PresetMidi::fromJson(json_t *root) {
     midi_device_claim = get_json_string(root, "midi-device");
     midi_device.set_claim(midi_device_claim);
     enable_logging(get_json_bool(root, "midi-log", is_logging()));
+    repeat.fromJson(root);
     // key
     key_channel = get_json_int(root, "key-channel", key_channel);
     key_code[KeyAction::KeySend]   = get_json_int(root, "key-send",   key_code[KeyAction::KeySend]);
@@ -106,6 +150,7 @@ json_t *PresetMidi::toJson() {
     json_t* root = json_object();
     set_json(root, "midi-device", midi_device_claim);
     set_json(root, "midi-log", is_logging());
+    repeat.toJson(root);
     // key
     set_json_int(root, "key-channel", key_channel);
     set_json_int(root, "key-send",    key_code[KeyAction::KeySend]);
@@ -132,6 +177,7 @@ json_t *PresetMidi::toJson() {
 void PresetMidi::onMidiDeviceChange(const MidiDeviceHolder *source)
 {
     if (source != &midi_device) return;
+    stop_hold();
     if (source) {
         midi_device_claim = source->get_claim();
         if (source->connection) {
@@ -194,12 +240,14 @@ void PresetMidi::reset_keyboard() {
     key_channel = UndefinedCode;
     key_page_mode = false;
     memset(key_code, UndefinedCode, KeyAction::Size);
+    stop_hold();
 }
 
 void PresetMidi::reset_controller() {
     cc_channel = UndefinedCode;
     cc_page_mode = false;
     cc_control.clear();
+    stop_hold();
 }
 
 bool PresetMidi::is_valid_cc_configuration() {
@@ -263,45 +311,117 @@ bool PresetMidi::is_logging() {
 }
 
 void PresetMidi::process(float sample_time) {
+    now += sample_time;
     midi_in.dispatch(sample_time);
+    if (held_direction) {
+        repeat_held(sample_time);
+    }
+    flush_nav();
 }
 
-void PresetMidi::learn_keyboard(PackedMidiMessage msg) {
-    if (!student || (Haken::keyOn != midi_status(msg))) return;
+ssize_t PresetMidi::nav_index() {
+    return (pending_index >= 0) ? pending_index : client->nav_get_index();
+}
 
-    if (undefined(key_channel) || (midi_channel(msg) == key_channel)) {
-        student->learn_value(learn, msg);
-    }
+void PresetMidi::nav_to(ssize_t index) {
+    pending_index = index;
 }
 
-void PresetMidi::learn_cc(PackedMidiMessage msg) {
-    if (!student || (Haken::ctlChg != midi_status(msg))) return;
-    if (undefined(cc_channel) || (midi_channel(msg) == cc_channel)) {
-        student->learn_value(learn, msg);
+void PresetMidi::nav_step(ssize_t steps, bool paging) {
+    if (0 == steps) return;
+    if (paging) {
+        nav_page(steps);
+        return;
     }
+    ssize_t total = client->nav_get_size();
+    if (total <= 0) return;
+    nav_to(std::max(ssize_t(0), std::min(nav_index() + steps, total - 1)));
 }
 
-void do_page(INavigateList* client, ssize_t page_dx) {
+void PresetMidi::nav_page(ssize_t page_dx) {
     if (0 == page_dx) return;
-    ssize_t index = client->nav_get_index();
+    ssize_t index = nav_index();
     ssize_t page_size = client->nav_get_page_size();
     ssize_t page = page_of_index(index, page_size);
     ssize_t offset = offset_of_index(index, page_size);
     page += page_dx;
     if (page >= 0) {
-        // if (page_dx > 0) {
-        //     ssize_t total = client->nav_get_size();
-        //     if (total <= 0) return;
-        //     auto last_page = page_of_index(total - 1);
-        //     if (page > last_page) return;
-        // }
         index = index_from_paged(page, offset, page_size);
         if (index < client->nav_get_size()) {
-            client->nav_set_index(index);
+            nav_to(index);
         }
     }
 }
 
+// The send goes out with the index current at the request, and several sends
+// in one dispatch window go out once.
+void PresetMidi::nav_request_send() {
+    pending_send = true;
+    send_index = nav_index();
+}
+
+void PresetMidi::flush_nav() {
+    if (pending_send) {
+        pending_send = false;
+        if (send_index != client->nav_get_index()) {
+            client->nav_set_index(send_index);
+        }
+        client->nav_send();
+        if (pending_index == send_index) {
+            pending_index = -1;
+        }
+    }
+    if (pending_index >= 0) {
+        client->nav_set_index(pending_index);
+        pending_index = -1;
+    }
+}
+
+void PresetMidi::start_hold(int direction, bool paging, uint8_t code, bool cc) {
+    if (!repeat.enabled) return;
+    held_direction = direction;
+    held_page = paging;
+    held_code = code;
+    held_cc = cc;
+    held_elapsed = 0.f;
+    next_repeat = repeat.delay;
+    held_interval = repeat.interval;
+    held_step = 1;
+    held_repeats = 0;
+}
+
+void PresetMidi::repeat_held(float sample_time) {
+    if (key_mute && !held_cc) {
+        stop_hold();
+        return;
+    }
+    held_elapsed += sample_time;
+    if (held_elapsed < next_repeat) return;
+
+    nav_step(held_direction * held_step, held_page);
+    next_repeat += held_interval;
+    if (held_interval > repeat.min_interval) {
+        held_interval = std::max(repeat.min_interval, held_interval * repeat.acceleration);
+    } else if (!held_page && (0 == (++held_repeats % 8))) {
+        held_step = std::min(held_step * 2, client->nav_get_page_size());
+    }
+}
+
+void PresetMidi::learn_keyboard(PackedMidiMessage msg) {
+    if (!student || (Haken::keyOn != midi_status(msg))) return;
+
+    if (undefined(key_channel) || (midi_channel(msg) == key_channel)) {
+        student->learn_value(learn, msg);
+    }
+}
+
+void PresetMidi::learn_cc(PackedMidiMessage msg) {
+    if (!student || (Haken::ctlChg != midi_status(msg))) return;
+    if (undefined(cc_channel) || (midi_channel(msg) == cc_channel)) {
+        student->learn_value(learn, msg);
+    }
+}
+
 void PresetMidi::do_key(PackedMidiMessage msg) {
     assert (client);
     assert(!key_mute);
@@ -311,7 +431,7 @@ void PresetMidi::do_key(PackedMidiMessage msg) {
     uint8_t note = midi_note(msg);
     if (note == key_code[KeyAction::KeySend]) {
         if (is_logging()) midi_log->log_message("PresetMidi", "send()");
-        client->nav_send();
+        nav_request_send();
         return;
     }
 
@@ -341,28 +461,15 @@ void PresetMidi::do_key(PackedMidiMessage msg) {
 
     if (note == key_code[KeyAction::KeyPrev]) {
         if (is_logging()) midi_log->log_message("PresetMidi", "Prev");
-        if (key_page_mode) {
-            do_page(client, -1);
-        }
-        else {
-            ssize_t index = client->nav_get_index();
-            if (--index >= 0) {
-                client->nav_set_index(index);
-            }
-        }
+        nav_step(-1, key_page_mode);
+        start_hold(-1, key_page_mode, note, false);
         return;
     }
 
     if (note == key_code[KeyAction::KeyNext]) {
         if (is_logging()) midi_log->log_message("PresetMidi", "Next");
-        if (key_page_mode) {
-            do_page(client, 1);
-        } else {
-            ssize_t index = client->nav_get_index();
-            if (++index < client->nav_get_size()) {
-                client->nav_set_index(index);
-            }
-        }
+        nav_step(1, key_page_mode);
+        start_hold(1, key_page_mode, note, false);
         return;
     }
 
@@ -371,13 +478,13 @@ void PresetMidi::do_key(PackedMidiMessage msg) {
         ssize_t increment = note - first_code;
         if (is_logging()) midi_log->log_message("PresetMidi", format_string("Index %d", increment));
         if (key_page_mode) {
-            do_page(client, increment);
+            nav_page(increment);
         } else {
             ssize_t page_size = client->nav_get_page_size();
-            ssize_t index = client->nav_get_index();
+            ssize_t index = nav_index();
             ssize_t page = page_of_index(index, page_size);
             index = std::min(index_from_paged(page, increment, page_size), client->nav_get_size()-1);
-            client->nav_set_index(index);
+            nav_to(index);
         }
     }
 }
@@ -399,6 +506,24 @@ bool control_triggered(CcControl& ctl, uint8_t new_value) {
     return false;
 }
 
+// Endless controllers wrap around 0..127, so the shorter way around is the movement.
+// Faster turning moves further, scaled by the rate of travel.
+ssize_t endless_steps(uint8_t last_value, uint8_t new_value, double dt)
+{
+    if (undefined(last_value)) return 0;
+    int delta = int(new_value) - int(last_value);
+    if (delta > 64) {
+        delta -= 128;
+    } else if (delta < -64) {
+        delta += 128;
+    }
+    if (0 == delta) return 0;
+    // about half a turn per second is deliberate one-at-a-time stepping
+    float rate = std::abs(delta) / std::max(dt, .001);
+    float scale = clamp(rate / 64.f, 1.f, 16.f);
+    return static_cast<ssize_t>(std::round(delta * scale));
+}
+
 void PresetMidi::do_cc(PackedMidiMessage msg)
 {
     assert (client);
@@ -413,7 +538,7 @@ void PresetMidi::do_cc(PackedMidiMessage msg)
         case ccAction::Unknown: break;
         case ccAction::Send:
             if (control_triggered(*it, new_value)) {
-                client->nav_send();
+                nav_request_send();
             }
             break;
 
@@ -427,23 +552,23 @@ void PresetMidi::do_cc(PackedMidiMessage msg)
                 ssize_t increment = 127/(1 + max_page);
                 page = std::min(static_cast<ssize_t>(midi_cc_value(msg)/increment), max_page);
             }
-            ssize_t index = client->nav_get_index();
+            ssize_t index = nav_index();
             ssize_t offset = offset_of_index(index, page_size);
             index = index_from_paged(page, offset, page_size);
             index = clamp(index, 0, total - 1);
-            client->nav_set_index(index);
+            nav_to(index);
         } break;
 
         case ccAction::Item: {
             ssize_t total = client->nav_get_size();
             if (total <= 0) return;
             ssize_t page_size = client->nav_get_page_size();
-            ssize_t index = client->nav_get_index();
+            ssize_t index = nav_index();
             ssize_t page = page_of_index(index, page_size);
             ssize_t offset = std::min(static_cast<ssize_t>(midi_cc_value(msg))/3, page_size-1);
             index = index_from_paged(page, offset, page_size);
             index = clamp(index, 0, total - 1);
-            client->nav_set_index(index);
+            nav_to(index);
         } break;
 
         case ccAction::Toggle: {
@@ -452,33 +577,24 @@ void PresetMidi::do_cc(PackedMidiMessage msg)
             }
         } break;
 
-        case ccAction::Prev: {
-            if (control_triggered(*it, new_value)) {
-                if (cc_page_mode) {
-                    do_page(client, -1);
-                } else {
-                    ssize_t index = client->nav_get_index();
-                    if (--index >= 0) {
-                        client->nav_set_index(index);
-                    }
-                }
-            }
-        } break;
-
+        case ccAction::Prev:
         case ccAction::Next: {
-            if (control_triggered(*it, new_value)) {
-                if (cc_page_mode) {
-                    do_page(client, 1);
-                } else {
-                    ssize_t index = client->nav_get_index();
-                    if (++index < client->nav_get_size()) {
-                        client->nav_set_index(index);
-                    }
+            int direction = (ccAction::Next == (*it).role) ? 1 : -1;
+            if (ControllerType::Endless == (*it).kind) {
+                // scrolls both ways, turning toward the control's own direction steps forward
+                nav_step(direction * endless_steps((*it).last_value, new_value, now - (*it).last_time), cc_page_mode);
+            } else if (control_triggered(*it, new_value)) {
+                nav_step(direction, cc_page_mode);
+                if (ControllerType::Momentary == (*it).kind) {
+                    start_hold(direction, cc_page_mode, cc, true);
                 }
+            } else if (ControllerType::Momentary == (*it).kind) {
+                release(cc, true);
             }
         } break;
         }
         (*it).last_value = new_value;
+        (*it).last_time = now;
     }
 }
 
@@ -487,6 +603,12 @@ void PresetMidi::do_message(PackedMidiMessage msg)
     if (!client) return;
     switch (learn) {
     case LearnMode::Off: {
+        bool note_off = (midi_status(msg) == Haken::keyOff)
+            || ((midi_status(msg) == Haken::keyOn) && (0 == msg.bytes.data2));
+        if (note_off) {
+            release(midi_note(msg), false);
+            return;
+        }
         if (!key_mute) {
             if ((midi_status(msg) == Haken::keyOn)
                 && ((AnyChannel == key_channel) || (midi_channel(msg) == key_channel))
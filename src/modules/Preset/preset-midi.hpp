@@ -68,6 +68,7 @@ struct CcControl {
     uint8_t base_value{UndefinedCode};
     ccAction role{ccAction::Unknown};
     ControllerType kind{ControllerType::Unknown};
+    double last_time{0}; // runtime: when last_value arrived, for endless velocity
 
     void init(const CcControl& source) {
         cc         = source.cc;
@@ -81,6 +82,25 @@ struct CcControl {
     void reset();
 };
 
+// Auto-repeat for held prev/next keys and momentary CCs.
+// Repeats start after `delay`, every `interval` seconds, speeding up by `acceleration`
+// per repeat to `min_interval`. Past that, cursor repeats move further at each step.
+struct NavRepeat {
+    enum Speed { Slow, Medium, Fast, NumSpeeds };
+
+    bool enabled{true};
+    int speed{Speed::Medium};
+    float delay{.4f};
+    float interval{.15f};
+    float min_interval{.04f};
+    float acceleration{.85f};
+
+    void set_speed(int speed);
+    void fromJson(json_t* root);
+    void toJson(json_t* root) const;
+};
+const char * repeat_speed_name(int speed);
+
 struct PresetMidi: IDoMidi, IMidiDeviceNotify {
 
     INavigateList* client{nullptr};
@@ -113,6 +133,24 @@ struct PresetMidi: IDoMidi, IMidiDeviceNotify {
     LearnMode learn{LearnMode::Off};
     ILearner* student{nullptr};
 
+    // navigation: moves and sends in a dispatch window are coalesced and applied once in process()
+    NavRepeat repeat;
+    double now{0};
+    ssize_t pending_index{-1};
+    ssize_t send_index{-1};
+    bool pending_send{false};
+
+    // held prev/next
+    int held_direction{0}; // -1 prev, +1 next, 0 none
+    bool held_page{false};
+    bool held_cc{false};
+    uint8_t held_code{UndefinedCode};
+    float held_elapsed{0};
+    float next_repeat{0};
+    float held_interval{0};
+    ssize_t held_step{1};
+    int held_repeats{0};
+
     PresetMidi(ChemId client_id, ChemDevice device);
     void init(INavigateList* nav);
 
@@ -148,6 +186,17 @@ struct PresetMidi: IDoMidi, IMidiDeviceNotify {
 
     void process(float sampleTime);
 
+    ssize_t nav_index();
+    void nav_to(ssize_t index);
+    void nav_step(ssize_t steps, bool paging);
+    void nav_page(ssize_t page_dx);
+    void nav_request_send();
+    void flush_nav();
+    void start_hold(int direction, bool paging, uint8_t code, bool cc);
+    void stop_hold() { held_direction = 0; held_code = UndefinedCode; }
+    void release(uint8_t code, bool cc) { if (held_direction && (code == held_code) && (cc == held_cc)) stop_hold(); }
+    void repeat_held(float sample_time);
+
     // IMidiDeviceHolder
     void onMidiDeviceChange(const MidiDeviceHolder* source) override;
 
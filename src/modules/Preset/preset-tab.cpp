@@ -57,11 +57,6 @@ bool search_match(const std::string &query, const std::string &text, bool anchor
 
 }
 
-bool PresetTabList::save()
-{
-    return preset_list->save();
-}
-
 void PresetTabList::set_filter(FilterId index, uint64_t mask)
 {
     if (filter_masks[index] != mask) {
@@ -89,7 +84,7 @@ void PresetTabList::no_filter()
         filtering = false;
         std::memset(filter_masks, 0, sizeof(filter_masks));
         search_query = "";
-        preset_view.clear();
+        refresh_filter_view();
     }
 }
 
@@ -100,11 +95,7 @@ void PresetTabList::set_search_query(std::string query, bool name, bool meta, bo
     search_meta = meta;
     search_anchor = anchor;
     filtering = mask_filtering || !search_query.empty();
-    if (!filtering) {
-        preset_view.clear();
-    } else {
-        refresh_filter_view();
-    }
+    refresh_filter_view();
 }
 
 inline bool zip_any_filter(uint64_t* a, uint64_t* b)
@@ -129,7 +120,10 @@ inline bool zip_any_filter(uint64_t* a, uint64_t* b)
 void PresetTabList::refresh_filter_view()
 {
     preset_view.clear();
-    if (filtering && preset_list) {
+    if (!preset_list || !use_view()) return;
+    if (!filtering) {
+        preset_view = preset_list->presets;
+    } else {
         auto inserter = std::back_inserter(preset_view);
         for (auto p: preset_list->presets) {
             bool match{true};
@@ -151,6 +145,9 @@ void PresetTabList::refresh_filter_view()
             }
         }
     }
+    if (reordered()) {
+        std::sort(preset_view.begin(), preset_view.end(), getPresetSort(order));
+    }
 }
 
 void PresetTabList::set_list(std::shared_ptr<PresetList> list)
@@ -179,20 +176,11 @@ ssize_t PresetTabList::index_of_id_unfiltered(PresetId id)
     return preset_list->index_of_id(id);
 }
 
-void PresetTabList::add(const PresetDescription* preset)
+void PresetTabList::sort(PresetOrder new_order)
 {
-    if (!preset_list) return;
-    preset_list->add(preset);
-}
-
-void PresetTabList::sort(PresetOrder order)
-{
-    if (!preset_list) return;
-    preset_list->sort(order);
-    if (filtered()) {
-        auto orderfn = getPresetSort(order);
-        std::sort(preset_view.begin(), preset_view.end(), orderfn);
-    }
+    if (order == new_order) return;
+    order = new_order;
+    refresh_filter_view();
 }
 
 
@@ -9,6 +9,9 @@ using namespace eaganmatrix;
 
 namespace pachde {
 
+// One Preset module's view of a host preset list.
+// The host list may be shared with other modules and Cores, so it is never changed here:
+// filtering and sorting go through preset_view.
 struct PresetTabList
 {
     PresetTabList(const PresetTabList&) = delete;
@@ -16,6 +19,7 @@ struct PresetTabList
     PresetTab tab;
     std::shared_ptr<PresetList> preset_list{nullptr};
     std::vector<std::shared_ptr<PresetInfo>> preset_view;
+    PresetOrder order{PresetOrder::None}; // None: the host list's order
 
     uint64_t filter_masks[5]{0};
     std::string search_query;
@@ -26,6 +30,10 @@ struct PresetTabList
     bool mask_filtering{false};
 
     bool filtered() { return filtering; }
+    // sorted differently from the host list
+    bool reordered() { return preset_list && (PresetOrder::None != order) && (order != preset_list->order); }
+    bool use_view() { return filtering || reordered(); }
+    PresetOrder get_order() { return (PresetOrder::None != order) ? order : (preset_list ? preset_list->order : PresetOrder::None); }
 
     void set_search_query(std::string query, bool name, bool meta, bool anchor);
     uint64_t get_filter(FilterId index) { return filter_masks[index]; }
@@ -39,27 +47,22 @@ struct PresetTabList
     }
     void set_list(std::shared_ptr<PresetList> list);
     bool empty() { return preset_list ? preset_list->empty() : true; }
-    bool dirty() { return preset_list ? preset_list->modified : false; }
-    void set_dirty() { assert(preset_list); preset_list->modified = true; }
-    size_t count() { return filtering ? preset_view.size() : (preset_list ? preset_list->size() : 0); }
+    size_t count() { return use_view() ? preset_view.size() : (preset_list ? preset_list->size() : 0); }
     ssize_t index_of_id(PresetId id);
     ssize_t index_of_id_unfiltered(PresetId id);
-    std::vector<std::shared_ptr<PresetInfo>>* presets() { return filtering ? &preset_view : (preset_list ? &preset_list->presets : nullptr); }
+    std::vector<std::shared_ptr<PresetInfo>>* presets() { return use_view() ? &preset_view : (preset_list ? &preset_list->presets : nullptr); }
 
     void refresh_filter_view();
 
-    void add(const PresetDescription* preset);
-
     void clear() {
         preset_view.clear();
         preset_list = nullptr;
     }
 
-    bool save();
     void sort(PresetOrder order);
     std::shared_ptr<PresetInfo> nth(ssize_t which) {
         if (which < 0) which = 0;
-        if (filtering) {
+        if (use_view()) {
             return preset_view.empty() ? nullptr : preset_view[which];
         } else {
             return !preset_list || preset_list->empty() ? nullptr : preset_list->presets[which];
@@ -300,6 +300,7 @@ struct ConfigPresetMidi : SvgDialog<DialogSvg> {
         addChild(createLabel(bounds["k:conn"], midi_handler->connection_name(), &info_right));
         addChild(createLabel(bounds["k:log-label"], "Log MIDI", &styles.left));
 
+        my_svgs.owner = this;
         my_svgs.changeTheme(svg_theme);
         applyChildrenTheme(this, svg_theme);
     }
@@ -277,17 +277,23 @@ void LearnMidiCc::start_listen(uint8_t code)
     action.cc = code;
     clock.start(.25f);
     message_count = 1;
+    wrapped = false;
     update_text();
 }
 
 void LearnMidiCc::learn_value(LearnMode mode, PackedMidiMessage msg) {
     assert(Haken::ctlChg == midi_status(msg));
     auto msg_cc = midi_cc(msg);
-    action.last_value = midi_cc_value(msg);
+    auto new_value = midi_cc_value(msg);
     if (defined(action.cc) && (msg_cc == action.cc)) {
+        if (defined(action.last_value) && (std::abs(int(new_value) - int(action.last_value)) > 64)) {
+            wrapped = true;
+        }
+        action.last_value = new_value;
         message_count++;
         return;
     }
+    action.last_value = new_value;
     start_listen(msg_cc);
 }
 
@@ -322,7 +328,7 @@ void LearnMidiCc::step() {
             action.base_value = action.last_value;
             break;
         default:
-            action.kind = ControllerType::Continuous;
+            action.kind = wrapped ? ControllerType::Endless : ControllerType::Continuous;
             action.base_value = 64;
             break;
         }
@@ -98,6 +98,7 @@ struct LearnMidiCc : MidiLearnerBase {
     std::string cc_text;
     WallTimer clock;
     int message_count{0};
+    bool wrapped{false}; // values jumped across 0/127: an endless controller
 
     std::function<void(ControllerType)> on_set_controller_type{nullptr};
 
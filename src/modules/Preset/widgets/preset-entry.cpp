@@ -10,6 +10,7 @@ namespace pachde {
 PresetEntry::PresetEntry(std::vector<PresetEntry*>& peers) :
     preset_index(-1),
     live(false),
+    pending(false),
     current(false),
     hovered(false),
     peers(peers)
@@ -33,7 +34,8 @@ void PresetEntry::set_preset(int index, bool is_current, bool is_live, std::shar
     live = is_live;
     current = is_current;
     label->set_text(preset->name);
-    label->describe(preset->meta_text());
+    // the tip is described on hover, so scrolling doesn't format metadata for every entry
+    label->describe(hovered ? preset->meta_text() : "");
     notifyChange(this);
 }
 
@@ -51,7 +53,8 @@ void PresetEntry::clear_preset()
     preset = nullptr;
     preset_index = -1;
     live = false;
-    current = false;;
+    pending = false;
+    current = false;
     label->set_text("");
     label->describe("");
     notifyChange(this);
@@ -61,12 +64,33 @@ void PresetEntry::applyTheme(std::shared_ptr<SvgTheme> theme)
 {
     preset_element.apply_theme(theme);
     live_element.apply_theme(theme);
+    pending_element.apply_theme(theme);
     current_element.apply_theme(theme);
     hover_element.apply_theme(theme);
     category_style.apply_theme(theme);
     //label->applyTheme(theme);
 }
 
+void PresetEntry::onEnter(const EnterEvent& e)
+{
+    Base::onEnter(e);
+    if (valid()) {
+        label->describe(preset->meta_text());
+        label->createTip();
+    }
+    hovered = true;
+}
+
+uint64_t PresetEntry::draw_signature()
+{
+    // by content: a new preset can be allocated where an old one was
+    uint64_t sig = preset ? std::hash<std::string>{}(preset->name) : 0;
+    sig = hash_mix(sig, preset ? preset->id.key() : PresetId::InvalidKey);
+    sig = hash_mix(sig, static_cast<uint64_t>(preset_index));
+    sig = hash_mix(sig, (live ? 1 : 0) | (current ? 2 : 0) | ((hovered && valid()) ? 4 : 0) | (pending ? 8 : 0));
+    return sig;
+}
+
 void PresetEntry::appendContextMenu(ui::Menu *menu)
 {
     if (preset) {
@@ -147,6 +171,9 @@ void PresetEntry::draw(const DrawArgs &args)
     auto vg = args.vg;
     if (live) {
         FittedBoxRect(vg, 0, 0, box.size.x + live_element.width(), box.size.y, live_element.nvg_stroke_color(), Fit::Inside, live_element.width());
+    } else if (pending) {
+        // requested, not loaded yet
+        FittedBoxRect(vg, 0, 0, box.size.x + pending_element.width(), box.size.y, pending_element.nvg_stroke_color(), Fit::Inside, pending_element.width());
     }
 
     if (hovered && valid()) {
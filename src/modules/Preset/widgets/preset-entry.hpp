@@ -2,6 +2,7 @@
 #include <rack.hpp>
 #include "widgets/label.hpp"
 #include "widgets/element-style.hpp"
+#include "widgets/cached-layer.hpp"
 #include "em/preset.hpp"
 
 using namespace eaganmatrix;
@@ -10,7 +11,7 @@ struct PresetUi;
 
 namespace pachde {
 
-struct PresetEntry : OpaqueWidget, IThemed
+struct PresetEntry : OpaqueWidget, IThemed, ICachedDraw
 {
     using Base = OpaqueWidget;
     TipLabel* label{nullptr};
@@ -18,11 +19,13 @@ struct PresetEntry : OpaqueWidget, IThemed
     ssize_t preset_index;
     std::shared_ptr<PresetInfo> preset{nullptr};
     bool live;
+    bool pending;
     bool current;
     bool hovered;
     std::vector<PresetEntry*>& peers;
     ElementStyle preset_element {"preset", "hsl(0, 0%, 55%)"};
     ElementStyle live_element   {"preset-live", "hsl(42, 50%, 50%)", "hsl(42, 50%, 50%)", .35f };
+    ElementStyle pending_element{"preset-pending", "hsla(42, 50%, 50%, 45%)", "hsla(42, 50%, 50%, 45%)", .35f };
     ElementStyle current_element{"preset-current", "hsl(60, 90%, 50%)", "hsl(60, 90%, 50%)", .25f};
     ElementStyle hover_element  {"preset-hover", "hsla(0, 0%, 100%, 5%)", "hsl(120, 50%, 30%)", .5f};
     ElementStyle category_style {"preset-cat", "hsl(200, 50%, 50%)"};
@@ -41,6 +44,7 @@ struct PresetEntry : OpaqueWidget, IThemed
     void send_preset();
 
     void applyTheme(std::shared_ptr<SvgTheme> theme) override;
+    uint64_t draw_signature() override;
     void appendContextMenu(ui::Menu* menu);
     void createContextMenu()
     {
@@ -52,13 +56,7 @@ struct PresetEntry : OpaqueWidget, IThemed
         Base::onHover(e);
         e.consume(this);
     }
-    void onEnter(const EnterEvent& e) override {
-        Base::onEnter(e);
-        if (valid()) {
-            label->createTip();
-        }
-        hovered = true;
-    }
+    void onEnter(const EnterEvent& e) override;
 
     void onLeave(const LeaveEvent& e) override {
         Base::onLeave(e);
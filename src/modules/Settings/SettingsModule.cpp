@@ -380,6 +380,7 @@ void SettingsModule::build_update(std::vector<PackedMidiMessage>& stream_data, i
 
 void SettingsModule::process(const ProcessArgs &args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
 
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
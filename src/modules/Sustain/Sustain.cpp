@@ -80,6 +80,7 @@ bool SusModule::connected()
 
 void SusModule::onPortChange(const PortChangeEvent &e)
 {
+    modulation.onPortChange(e);
     getParam(P_MOD_AMOUNT).setValue(0.f);
     modulation.pull_mod_amount();
 }
@@ -106,14 +107,16 @@ void SusModule::process_params(const ProcessArgs &args)
 
 void SusModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
+    bool sync_ready = modulation.sync_params_ready(args);
 
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
     if (0 == ((args.frame + id) % 45)) {
         process_params(args);
     }
-    if (modulation.sync_params_ready(args)) {
+    if (sync_ready) {
         modulation.sync_send();
     }
 
@@ -27,7 +27,7 @@ struct OverlayMenu: Hamburger
 
         auto preset = ui->my_module ? ui->my_module->live_preset : nullptr;
         menu->addChild(createMenuItem("Use live preset", preset ? preset->summary() : "<none>", [=](){
-            ui->my_module->overlay_preset = ui->my_module->live_preset;
+            ui->my_module->overlay_preset = std::make_shared<PresetInfo>(*ui->my_module->live_preset);
             ui->my_module->preset_connected = true;
             ui->my_module->notify_connect_preset();
         }, !preset));
@@ -11,7 +11,6 @@ OverlayModule::OverlayModule()
 
     mac_build.client_id = ChemId::Overlay;
     mac_build.set_on_complete([=](){ on_macro_request_complete(); });
-    midi_timer.time = (random::uniform() * MIDI_RATE); // jitter
 }
 
 OverlayModule::~OverlayModule()
@@ -237,9 +236,10 @@ void OverlayModule::onPresetChange()
     preset_connected = false;
     if (!chem_host) return;
 
-    auto p = chem_host->host_preset();
+    auto snapshot = chem_host->host_preset_snapshot();
+    auto p = snapshot ? snapshot->preset.get() : nullptr;
     if (p && !p->empty()) {
-        live_preset = std::make_shared<PresetInfo>(p);
+        live_preset = snapshot->preset;
         preset_connected = (nullptr != overlay_preset) && (p->id.key() == overlay_preset->id.key());
         getLightInfo(L_CONNECTED)->name = preset_connected ? overlay_preset->name + " connected" : "Preset connected";
         notify_connect_preset();
@@ -257,15 +257,6 @@ void OverlayModule::onConnectionChange(ChemDevice device, std::shared_ptr<MidiDe
     onPresetChange();
 }
 
-bool OverlayModule::sync_params_ready(const rack::engine::Module::ProcessArgs &args, float rate)
-{
-    if (midi_timer.process(args.sampleTime) > rate) {
-        midi_timer.reset();
-        return true;
-    }
-    return false;
-}
-
 void OverlayModule::do_message(PackedMidiMessage message)
 {
     if (mac_build.in_request) {
@@ -275,6 +266,7 @@ void OverlayModule::do_message(PackedMidiMessage message)
 
 void OverlayModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
 
@@ -305,17 +297,15 @@ void OverlayModule::process(const ProcessArgs& args)
         return;
     }
 
-    auto haken = chem_host->host_haken();
-    if (!haken) return;
+    // The Core's scheduler coalesces and paces macro traffic across all overlays,
+    // so changes are posted as they happen.
+    auto scheduler = chem_host->host_macro_scheduler();
+    if (!scheduler) return;
 
-    if (sync_params_ready(args)) {
-        for (auto macro: macros.data) {
-            if (macro->valid()) {
-                if (macro->pending()) {
-                    macro->un_pend();
-                    haken->extended_macro(ChemId::Overlay, macro->macro_number, macro->em_value);
-                }
-            }
+    for (auto macro: macros.data) {
+        if (macro->valid() && macro->pending()) {
+            macro->un_pend();
+            scheduler->post(ChemId::Overlay, macro->macro_number, macro->em_value);
         }
     }
 
@@ -39,10 +39,9 @@ struct OverlayModule : ChemModule, IChemClient, IDoMidi, IOverlay
     PackedColor fg_color{0xffe6e6e6};
     int paused_clients{0};
 
-    rack::dsp::Timer midi_timer;
     std::string device_claim;
     std::shared_ptr<PresetInfo> overlay_preset{nullptr};
-    std::shared_ptr<PresetInfo> live_preset{nullptr};
+    std::shared_ptr<const PresetInfo> live_preset{nullptr};
     std::string title{DEFAULT_TITLE};
 
     std::vector<std::shared_ptr<ClientInfo>> clients;
@@ -55,7 +54,6 @@ struct OverlayModule : ChemModule, IChemClient, IDoMidi, IOverlay
 
     OverlayUi* ui() { return reinterpret_cast<OverlayUi*>(chem_ui); };
 
-    bool sync_params_ready(const rack::engine::Module::ProcessArgs &args, float rate = MOD_MIDI_RATE);
     void update_from_em();
     void on_macro_request_complete();
     bool client_editing();
@@ -67,7 +65,7 @@ struct OverlayModule : ChemModule, IChemClient, IDoMidi, IOverlay
     void overlay_unregister_client(IOverlayClient* client) override;
     const std::string& overlay_title() override { return title; }
     void overlay_client_pause(IOverlayClient* client, bool pausing) override;
-    std::shared_ptr<PresetInfo> overlay_live_preset() override { return live_preset; }
+    std::shared_ptr<const PresetInfo> overlay_live_preset() override { return live_preset; }
     std::shared_ptr<PresetInfo> overlay_configured_preset() override { return overlay_preset; }
     void overlay_request_macros() override;
     MacroReadyState overlay_macros_ready() override;
@@ -758,6 +758,7 @@ void XMUi::set_edit_mode(bool edit)
         }
     }
     editing = edit;
+    if (my_module) my_module->ui_editing.store(edit, std::memory_order_relaxed);
 }
 
 void XMUi::commit_macro()
@@ -902,6 +903,13 @@ void XMUi::step()
     }
     panelBorder->setPartners(left, right);
 
+    if (edit_macro && (MacroRange::Custom == edit_macro->macro.range)) {
+        float rmin = my_module->getParam(XMModule::P_RANGE_MIN).getValue();
+        float rmax = my_module->getParam(XMModule::P_RANGE_MAX).getValue();
+        edit_macro->macro.min = std::min(rmin, rmax);
+        edit_macro->macro.max = std::max(rmin, rmax);
+    }
+
     for (auto macro : my_module->my_macros.data) {
         int i = macro->knob_id;
         if ((i == my_module->mod_target) && knobs[XMModule::P_MODULATION]) {
@@ -336,6 +336,7 @@ void XMModule::onPortChange(const PortChangeEvent& e)
 
 void XMModule::process(const ProcessArgs& args)
 {
+    PerfScope perf_scope(perf_process);
     ChemModule::process(args);
     auto jitter_frame = args.frame + id;
 
@@ -358,23 +359,13 @@ void XMModule::process(const ProcessArgs& args)
         }
         getLight(L_OVERLAY).setSmoothBrightness((overlay ? 1.0f : 0.f), 90);
         getLight(L_CORE).setSmoothBrightness(overlay && chem_host, 90);
-
-        auto edit_macro = chem_ui ? ui()->get_edit_macro() : nullptr;
-        if (edit_macro && (MacroRange::Custom == edit_macro->range)) {
-            float rmin = getParam(Params::P_RANGE_MIN).getValue();
-            float rmax = getParam(Params::P_RANGE_MAX).getValue();
-            float min = std::min(rmin, rmax);
-            float max = std::max(rmin, rmax);
-            edit_macro->min = min;
-            edit_macro->max = max;
-        }
     }
 
     if (!overlay) { return; }
     if (!host_connected(chem_host) || chem_host->host_busy()) return;
     if (!overlay->overlay_preset_connected()) { return; }
     if (!chem_ui) { return; }
-    if (ui()->editing) { return; }
+    if (ui_editing.load(std::memory_order_relaxed)) { return; }
 
     for (auto macro: my_macros.data) {
         auto knob = macro->knob_id;
@@ -46,6 +46,7 @@ struct XMModule : ChemModule, IChemClient, IDoMidi, IOverlayClient
     int mod_target{-1};
     int last_mod_target{-2};
     bool glow_knobs;
+    std::atomic<bool> ui_editing{false}; // published by the UI for process()
 
     MacroData my_macros;
 
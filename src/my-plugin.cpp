@@ -1,5 +1,6 @@
 #include "my-plugin.hpp"
 #include "services/svg-theme-load.hpp"
+#include <future>
 
 ::rack::plugin::Plugin *pluginInstance(nullptr);
 
@@ -64,49 +65,143 @@ RackSvgCache * getRackSvgs() { return &rack_svg_cache;}
 SvgNoCache no_svg_cache;
 SvgNoCache * getSvgNoCache() { return &no_svg_cache; }
 
+// Themes load on demand: the first theme asked for is parsed on the UI thread,
+// and the rest are parsed in the background, ready for theme menus and switching.
+
+struct ThemeFile {
+    const char * file;
+    const char * name; // must match the file's @theme
+};
+static const ThemeFile theme_files[] = {
+    { "res/themes/Light.vgt",  "Light" },
+    { "res/themes/Dark.vgt",   "Dark" },
+    { "res/themes/High.vgt",   "High Contrast" },
+    { "res/themes/Gray.vgt",   "Gray" },
+    { "res/themes/Ice.vgt",    "Ice" },
+    { "res/themes/Katy.vgt",   "Katy" },
+    { "res/themes/Mellow.vgt", "Mellow" },
+    { "res/themes/Wire.vgt",   "Wire" }
+};
+constexpr const size_t THEME_FILE_COUNT = sizeof(theme_files)/sizeof(theme_files[0]);
+
 ThemeCache theme_cache;
+std::future<std::vector<std::shared_ptr<SvgTheme>>> background_themes;
+bool themes_started{false};
+// Each file is parsed once, by whichever of getTheme or the background pass claims it first.
+std::atomic<bool> theme_claimed[THEME_FILE_COUNT];
+pachde::FileStamps theme_stamps;
+
+static std::shared_ptr<SvgTheme> loadTheme(const std::string& path)
+{
+#ifdef DEV_BUILD
+    DEBUG("Loading %s", path.c_str());
+    ErrorContext err;
+    auto theme = loadSvgThemeFile(path, &err);
+    if (!theme) {
+        auto report = err.makeErrorReport();
+        WARN("%s", report.c_str());
+    }
+    return theme;
+#else
+    return loadSvgThemeFile(path, nullptr);
+#endif
+}
+
+// Move themes parsed in the background into the cache, optionally waiting for them.
+static void collectBackgroundThemes(bool wait)
+{
+    if (!background_themes.valid()) return;
+    if (!wait && (std::future_status::ready != background_themes.wait_for(std::chrono::seconds(0)))) return;
+    for (auto theme: background_themes.get()) {
+        // keep a theme already loaded on demand: widgets may be holding it
+        if (theme && !theme_cache.getTheme(theme->name)) {
+            theme_cache.addTheme(theme);
+        }
+    }
+}
+
+void initThemeCache() {
+    if (themes_started) return;
+    themes_started = true;
+
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < THEME_FILE_COUNT; i++) {
+        paths.push_back(asset::plugin(pluginInstance, theme_files[i].file));
+        theme_stamps.stamp(paths.back());
+    }
+    background_themes = std::async(std::launch::async, [paths]() {
+        std::vector<std::shared_ptr<SvgTheme>> themes;
+        for (size_t i = 0; i < paths.size(); i++) {
+            if (theme_claimed[i].exchange(true)) continue; // loaded on demand
+            themes.push_back(loadTheme(paths[i]));
+        }
+        return themes;
+    });
+}
+
+const std::vector<std::string>& getThemeNames() {
+    static std::vector<std::string> names;
+    if (names.empty()) {
+        for (size_t i = 0; i < THEME_FILE_COUNT; i++) {
+            names.push_back(theme_files[i].name);
+        }
+    }
+    return names;
+}
+
+std::shared_ptr<SvgTheme> getTheme(const std::string& name) {
+    auto theme = theme_cache.getTheme(name);
+    if (theme) return theme;
+
+    size_t index = 0;
+    while ((index < THEME_FILE_COUNT) && (name != theme_files[index].name)) index++;
+    if (index == THEME_FILE_COUNT) return nullptr;
+
+    // claimed before the background pass starts, so the first theme isn't parsed twice
+    bool claimed = !theme_claimed[index].exchange(true);
+    initThemeCache();
+    if (claimed) {
+        theme = loadTheme(asset::plugin(pluginInstance, theme_files[index].file));
+        if (theme) theme_cache.addTheme(theme);
+        return theme;
+    }
+    // parsed, or being parsed, in the background
+    collectBackgroundThemes(true);
+    return theme_cache.getTheme(name);
+}
 
 ThemeCache& getThemeCache() {
     initThemeCache();
+    collectBackgroundThemes(true);
     return theme_cache;
 }
 
 void reloadThemeCache() {
+    if (background_themes.valid()) {
+        background_themes.wait();
+        background_themes = {};
+    }
     theme_cache.clear();
+    theme_stamps.clear();
+    for (auto& claim : theme_claimed) {
+        claim.store(false);
+    }
+    themes_started = false;
     initThemeCache();
 }
 
-static const char * theme_files[] = {
-        "res/themes/Light.vgt",
-        "res/themes/Dark.vgt",
-        "res/themes/High.vgt",
-        "res/themes/Gray.vgt",
-        "res/themes/Ice.vgt",
-        "res/themes/Katy.vgt",
-        "res/themes/Mellow.vgt",
-        "res/themes/Wire.vgt"
-    };
-void initThemeCache() {
-    if (!theme_cache.themes.empty()) return;
-#ifdef DEV_BUILD
-            ErrorContext err;
-            ErrorContext* error_context = &err;
-#else
-            ErrorContext* error_context = nullptr;
-#endif
-    for (size_t i = 0; i < sizeof(theme_files)/sizeof(theme_files[0]); i++) {
-#ifdef DEV_BUILD
-        DEBUG("Loading %s", theme_files[i]);
-#endif
-        auto theme = loadSvgThemeFile(asset::plugin(pluginInstance, theme_files[i]), error_context);
-#ifdef DEV_BUILD
-        if (!theme) {
-            auto report = err.makeErrorReport();
-            WARN("%s", report.c_str());
-            err.clear();
+std::vector<std::string> reloadChangedThemes() {
+    std::vector<std::string> names;
+    if (!themes_started) return names;
+    collectBackgroundThemes(true);
+    for (size_t i = 0; i < THEME_FILE_COUNT; i++) {
+        auto path = asset::plugin(pluginInstance, theme_files[i].file);
+        if (!theme_stamps.changed(path)) continue;
+        auto theme = loadTheme(path);
+        if (theme) {
+            theme_cache.addTheme(theme);
+            names.push_back(theme->name);
         }
-#endif
-        if (theme) theme_cache.addTheme(theme);
     }
-    //theme_cache.sort();
+    return names;
 }
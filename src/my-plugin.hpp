@@ -27,6 +27,13 @@ extern Model* modelMidiPad;
 
 void initThemeCache();
 void reloadThemeCache();
+// Reparse only the theme files changed on disk, returning the names of the reloaded themes
+std::vector<std::string> reloadChangedThemes();
+// Get a theme by name, loading it if needed
+std::shared_ptr<::svg_theme::SvgTheme> getTheme(const std::string& name);
+// names of the available themes, without loading them
+const std::vector<std::string>& getThemeNames();
+// all themes (waits for any still loading)
 ::svg_theme::ThemeCache& getThemeCache();
 ::svg_theme::RackSvgCache* getRackSvgs();
 ::svg_theme::SvgNoCache* getSvgNoCache();
@@ -27,7 +27,9 @@ void HakenMidiOutput::dispatch(float sampleTime)
     float midi_time = midi_timer.process(sampleTime);
     if (midi_time < MIDI_RATE) return;
     midi_timer.reset();
+    if (ring.empty()) return;
 
+    PerfScope perf(perf_dispatch);
     output.channel = -1;
     while (!ring.empty()) {
         auto message = ring.shift();
@@ -35,6 +37,7 @@ void HakenMidiOutput::dispatch(float sampleTime)
             log->logMidi(IO_Direction::Out, message);
         }
         ++message_count;
+        perf_messages.add();
         output.setChannel(-1);
         output.sendMessage(rackFromPacked(message));
     }
@@ -44,16 +47,43 @@ void HakenMidiOutput::queueMessage(PackedMidiMessage msg)
 {
     if (!enabled) return;
     if (ring.full()) {
+        perf_overflow.add();
         assert(false);
     } else {
         ring.push(msg);
+        perf_queue_peak.peak(ring.size());
     }
 }
 
+void HakenMidiOutput::register_perf(PerfGroup& group, const std::string& prefix)
+{
+    group.add(prefix + ".messages", &perf_messages);
+    group.add(prefix + ".overflow", &perf_overflow);
+    group.add(prefix + ".queue-peak", &perf_queue_peak);
+    group.add(prefix + ".dispatch", &perf_dispatch);
+}
+
 void HakenMidiOutput::do_message(PackedMidiMessage message)
 {
     if (!enabled || ChemId::Haken == as_chem_id(message.bytes.tag)) return;
     queueMessage(message);
 }
 
+// A batch is queued whole or not at all, so a device never sees half of a pad's program.
+void HakenMidiOutput::do_messages(const PackedMidiMessage* messages, size_t count)
+{
+    if (!enabled || !count) return;
+    if (ring.capacity() < count) { // capacity() is the free space
+        perf_overflow.add();
+        assert(false);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (ChemId::Haken != as_chem_id(messages[i].bytes.tag)) {
+            ring.push(messages[i]);
+        }
+    }
+    perf_queue_peak.peak(ring.size());
+}
+
 }
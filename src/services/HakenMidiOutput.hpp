@@ -14,6 +14,12 @@ struct HakenMidiOutput : IDoMidi
     rack::dsp::RingBuffer<PackedMidiMessage, 1024> ring;
     rack::dsp::Timer midi_timer;
 
+    PerfCounter perf_messages;
+    PerfCounter perf_overflow;
+    PerfCounter perf_queue_peak;
+    PerfTimer perf_dispatch;
+    void register_perf(PerfGroup& group, const std::string& prefix);
+
     HakenMidiOutput(const HakenMidiOutput&) = delete; // no copy constructor
     HakenMidiOutput() :
         message_count(0),
@@ -25,6 +31,8 @@ struct HakenMidiOutput : IDoMidi
     void enable(bool on = true);
     void queueMessage(PackedMidiMessage msg);
     void dispatch(float sampleTime);
+    // dispatch(sampleTime) will send what's queued
+    bool dispatch_due(float sampleTime) { return midi_timer.time + sampleTime >= MIDI_RATE; }
 
     midi::Output& midi_out() { return output; }
     void clear();
@@ -37,6 +45,7 @@ struct HakenMidiOutput : IDoMidi
 
     // IDoMidi
     void do_message(PackedMidiMessage message) override;
+    void do_messages(const PackedMidiMessage* messages, size_t count) override;
 };
 
 }
\ No newline at end of file
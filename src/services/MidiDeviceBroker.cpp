@@ -9,11 +9,99 @@ std::shared_ptr<MidiDeviceBroker> MidiDeviceBroker::get()
     return the_broker_instance;
 }
 
+MidiDeviceSnapshot::MidiDeviceSnapshot(std::vector<std::shared_ptr<MidiDeviceConnection>> && list) :
+    connections(std::move(list))
+{
+    for (auto connection: connections) {
+        connection->info.claim();
+    }
+    by_claim = connections;
+    std::sort(by_claim.begin(), by_claim.end(), [](const std::shared_ptr<MidiDeviceConnection>& a, const std::shared_ptr<MidiDeviceConnection>& b) {
+        return a->info.claim_spec < b->info.claim_spec;
+    });
+}
+
+std::shared_ptr<MidiDeviceConnection> MidiDeviceSnapshot::find(const std::string& claim) const
+{
+    auto it = std::lower_bound(by_claim.cbegin(), by_claim.cend(), claim, [](const std::shared_ptr<MidiDeviceConnection>& item, const std::string& claim) {
+        return item->info.claim_spec < claim;
+    });
+    if (it != by_claim.cend() && (*it)->info.claim_spec == claim) {
+        return *it;
+    }
+    return nullptr;
+}
+
+bool MidiDeviceSnapshot::same_devices(const MidiDeviceSnapshot* other) const
+{
+    if (!other || other->by_claim.size() != by_claim.size()) return false;
+    for (size_t i = 0; i < by_claim.size(); ++i) {
+        auto a = by_claim[i];
+        auto b = other->by_claim[i];
+        if ((a->info.claim_spec != b->info.claim_spec)
+            || (a->driver_id != b->driver_id)
+            || (a->input_device_id != b->input_device_id)
+            || (a->output_device_id != b->output_device_id))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----  MidiDeviceBroker  ----------------------------
+
 MidiDeviceBroker::MidiDeviceBroker()
 {
     holders.reserve(8);
 }
 
+MidiDeviceBroker::~MidiDeviceBroker()
+{
+    stopping = true;
+    enumerate_signal.notify_one();
+    if (enumerator.joinable()) {
+        enumerator.join();
+    }
+}
+
+void MidiDeviceBroker::refresh()
+{
+    static std::once_flag started;
+    std::call_once(started, [this]() {
+        enumerator = std::thread([this]() {
+            while (!stopping) {
+                {
+                    std::unique_lock<std::mutex> guard(enumerate_lock);
+                    // the timeout covers a request that arrives just before we wait
+                    enumerate_signal.wait_for(guard, std::chrono::seconds(1), [this]() {
+                        return enumerate_requested || stopping;
+                    });
+                }
+                if (stopping) break;
+                if (!enumerate_requested.exchange(false)) continue;
+                // tickets taken after this point get another pass
+                uint64_t serving = sync_ticket;
+
+                auto fresh = std::make_shared<MidiDeviceSnapshot>(EnumerateMidiConnections(false));
+                auto current = std::atomic_load(&snapshot);
+                if (!fresh->same_devices(current.get())) {
+                    fresh->generation = current ? current->generation + 1 : 1;
+                    std::atomic_store(&snapshot, std::shared_ptr<const MidiDeviceSnapshot>(fresh));
+                }
+                served_ticket = serving;
+            }
+        });
+    });
+    enumerate_requested = true;
+    enumerate_signal.notify_one();
+}
+
+std::shared_ptr<const MidiDeviceSnapshot> MidiDeviceBroker::devices()
+{
+    return std::atomic_load(&snapshot);
+}
+
 bool MidiDeviceBroker::is_primary(MidiDeviceHolder* holder)
 {
     assert(!holders.empty());
@@ -50,22 +138,30 @@ bool MidiDeviceBroker::available(const std::string& claim)
 }
 
 
-// reconcile currently available devices with claimed devices
 void MidiDeviceBroker::sync()
 {
-    std::map<std::string,std::shared_ptr<MidiDeviceConnection>> connections;
-    for (auto connection : EnumerateMidiConnections(false)) {
-        connections.insert(std::make_pair(connection->info.claim(), connection));
+    if (synced()) {
+        ++sync_ticket;
     }
+    refresh();
+}
+
+// reconcile claimed devices with an enumeration newer than the last sync request
+bool MidiDeviceBroker::poll_sync()
+{
+    uint64_t served = served_ticket;
+    if (served <= reconciled_ticket) return false;
+    reconciled_ticket = served;
+
+    auto current = devices();
+    if (!current) return false;
 
     // bind registered holder claims
     for (auto holder: holders) {
-        auto holder_claim = holder->get_claim();
-        auto cit = connections.find(holder_claim);
-        if (cit != connections.cend()) {
+        auto c2 = current->find(holder->get_claim());
+        if (c2) {
             if (holder->connection) {
                 auto hc = holder->connection;
-                auto c2 = cit->second;
                 if ((hc->input_device_id != c2->input_device_id)
                     || (hc->driver_id != c2->driver_id)
                     || (hc->output_device_id != c2->output_device_id))
@@ -73,21 +169,28 @@ void MidiDeviceBroker::sync()
                     holder->connect(c2);
                 }
             } else {
-                holder->connect(cit->second);
+                holder->connect(c2);
             }
         } else {
             holder->connect(nullptr);
         }
     }
+    return true;
 }
 
 bool MidiDeviceBroker::bindAvailableEm(MidiDeviceHolder* holder)
 {
     assert(std::find(holders.cbegin(), holders.cend(), holder) != holders.cend()); // only registered holders should call this
 
-    for (auto connection : EnumerateMidiConnections(true)) {
-        auto claim = connection->info.claim();
-        if (available(claim)) {
+    if (!synced()) return false; // wait for the requested enumeration
+    auto current = devices();
+    if (!current) {
+        sync();
+        return false;
+    }
+    for (auto connection : current->connections) {
+        if (!is_EMConnection(connection->info)) continue;
+        if (available(connection->info.claim_spec)) {
             holder->connect(connection);
             return true;
         }
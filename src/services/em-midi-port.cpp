@@ -31,13 +31,11 @@ void EmControlPort::send(IChemHost* chem, ChemId tag, bool force)
         break;
 
     case PortKind::Stream:
-        haken->begin_stream(tag, channel_stream);
-        haken->stream_data(tag, cc_id, em_low());
+        haken->poke_stream(tag, channel_stream, cc_id, em_low());
         break;
 
     case PortKind::StreamIndex:
-        haken->begin_stream(tag, channel_stream);
-        haken->stream_data(tag, cc_id, em_value & 0x7f);
+        haken->poke_stream(tag, channel_stream, cc_id, em_value & 0x7f);
         break;
 
     default:
@@ -46,6 +44,32 @@ void EmControlPort::send(IChemHost* chem, ChemId tag, bool force)
     }
 }
 
+bool EmControlPort::pending()
+{
+    if ((em_value == last_em_value) || (UNSET_16 == last_em_value)) return false;
+    if (PortKind::StreamIndex == kind) return true;
+    if (low_resolution) {
+        // only the high 7 bits are sent
+        return (em_value >> 7) != (last_em_value >> 7);
+    }
+    if (0.f == mod_amount) return true;
+
+    // Hysteresis: continuing in the direction of the last send needs the deadband,
+    // turning around needs twice that, so noise around a steady value isn't sent.
+    int delta = static_cast<int>(em_value) - static_cast<int>(last_em_value);
+    int8_t direction = (delta > 0) ? 1 : -1;
+    int threshold = (direction == last_direction) ? MOD_DEADBAND : 2 * MOD_DEADBAND;
+    return std::abs(delta) >= threshold;
+}
+
+uint16_t EmControlPort::send_step()
+{
+    if (PortKind::StreamIndex == kind) return 1;
+    if (low_resolution) return 128;
+    if (0.f == mod_amount) return 1;
+    return MOD_DEADBAND;
+}
+
 void EmControlPort::pull_param_cv(Module* module)
 {
     if (!module) return;
@@ -53,6 +77,12 @@ void EmControlPort::pull_param_cv(Module* module)
     set_param_and_em(module->getParam(param_id).getValue());
 }
 
+void EmControlPort::pull_param(Module* module)
+{
+    if (!module) return;
+    set_param_and_em(module->getParam(param_id).getValue());
+}
+
 void EmControlPort::set_mod_amount(float amount)
 {
     if (kind == PortKind::StreamIndex) return;
@@ -88,13 +118,73 @@ float EmControlPort::modulate()
 
 bool Modulation::sync_params_ready(const rack::engine::Module::ProcessArgs &args, float rate)
 {
-    if (midi_timer.process(args.sampleTime) > rate) {
+    filter_cv(args.sampleTime);
+    float elapsed = midi_timer.process(args.sampleTime);
+    if (elapsed > rate) {
         midi_timer.reset();
+        settled = !cv_moved();
         return true;
     }
+    if ((elapsed > MOD_MIDI_FAST_RATE) && cv_moving()) {
+        settled = false;
+        perf_fast_sync.add();
+        midi_timer.reset();
+        return true;
+    }
+    return false;
+}
+
+void Modulation::filter_cv(float sample_time)
+{
+    if (cv_stage1.empty()) return;
+    if (sample_time != cv_sample_time) {
+        cv_sample_time = sample_time;
+        cv_k = 1.f - std::exp(-2.f * M_PI * MOD_CV_CUTOFF * sample_time);
+    }
+    if (!connected) return;
+    const int* input = cv_inputs.data();
+    int slot = 0;
+    for (size_t lane = 0; lane < cv_stage1.size(); ++lane) {
+        simd::float_4 v;
+        for (int i = 0; i < 4; ++i, ++input, ++slot) {
+            v[i] = input_connected(slot) ? module->getInput(*input).getVoltage() : 0.f;
+        }
+        cv_stage1[lane] += cv_k * (v - cv_stage1[lane]);
+        cv_stage2[lane] += cv_k * (cv_stage1[lane] - cv_stage2[lane]);
+    }
+}
+
+// true when some modulated port's smoothed CV has moved at least one step
+// of the port's resolution since it was last sent
+bool Modulation::cv_moved()
+{
+    if (!connected) return false;
+    for (auto& port: ports) {
+        if (!input_connected(port.index) || (0.f == port.mod_amount)) continue;
+        float delta = std::abs(filtered_cv(port.index) - port.cv) * std::abs(port.mod_amount) * .01f;
+        if (delta * (Haken::max14 * .1f) >= port.send_step()) {
+            return true;
+        }
+    }
     return false;
 }
 
+// CV has moved, and the host's MIDI output has room
+bool Modulation::cv_moving()
+{
+    if (!cv_moved()) return false;
+    auto host = module->chem_host;
+    return host && (host->host_midi_load() < MOD_MIDI_CONGESTED);
+}
+
+void Modulation::pull_port(EmControlPort& port)
+{
+    if (port.has_input()) {
+        port.cv = filtered_cv(port.index);
+    }
+    port.pull_param(module);
+}
+
 Modulation::Modulation(ChemModule *module, ChemId client_tag) :
     module(module),
     mod_target(-1),
@@ -106,10 +196,24 @@ Modulation::Modulation(ChemModule *module, ChemId client_tag) :
 {
     assert(module);
     midi_timer.time = (random::uniform() * MIDI_RATE); // jitter
+    module->perf.add("modulation.sent", &perf_sent);
+    module->perf.add("modulation.held", &perf_held);
+    module->perf.add("modulation.fast-sync", &perf_fast_sync);
+    module->perf.add("modulation.sync", &perf_sync);
+}
+
+static void index_port(std::vector<int>& index, int id, int port)
+{
+    if (id < 0) return;
+    if (id >= static_cast<int>(index.size())) {
+        index.resize(id + 1, -1);
+    }
+    index[id] = port;
 }
 
 void Modulation::configure(int mod_param_id, int data_length, const EmccPortConfig *data)
 {
+    assert(data_length <= 64); // connected bitmask
     mod_param = mod_param_id;
     count = data_length;
     ports.reserve(data_length);
@@ -117,6 +221,20 @@ void Modulation::configure(int mod_param_id, int data_length, const EmccPortConf
         EmControlPort port(i, data++);
         if (port.is_stream_poke()) { have_stream = true; }
         ports.push_back(port);
+        index_port(param_ports, port.param_id, i);
+        index_port(input_ports, port.input_id, i);
+        index_port(light_ports, port.light_id, i);
+    }
+
+    bool any_input = std::any_of(ports.cbegin(), ports.cend(), [](const EmControlPort& port) { return port.input_id >= 0; });
+    if (any_input) {
+        size_t lanes = (ports.size() + 3) / 4;
+        cv_inputs.assign(lanes * 4, -1);
+        for (auto& port: ports) {
+            cv_inputs[port.index] = port.input_id;
+        }
+        cv_stage1.assign(lanes, simd::float_4::zero());
+        cv_stage2.assign(lanes, simd::float_4::zero());
     }
 }
 
@@ -141,32 +259,35 @@ void Modulation::set_em_and_param_low(int index, uint8_t em_value, bool with_mod
 void Modulation::onPortChange(const ::rack::engine::Module::PortChangeEvent &e)
 {
     if (e.type == Port::OUTPUT) return;
-    if (e.connecting) {
-        auto port = get_input_port(e.portId);
-        if (!port) return; // unmodulated port
+    auto port = get_input_port(e.portId);
+    if (!port) return; // unmodulated port
 
+    uint64_t bit = uint64_t(1) << port->index;
+    if (e.connecting) {
+        connected |= bit;
+        if (!cv_stage1.empty()) {
+            // start smoothing from zero, as for a fresh cable
+            cv_stage1[port->index >> 2][port->index & 3] = 0.f;
+            cv_stage2[port->index >> 2][port->index & 3] = 0.f;
+        }
         mod_target = port->index;
         auto pq = module->getParamQuantity(mod_param);
         if (pq) {
             pq->setImmediateValue(ports[mod_target].modulation_amount());
         }
     } else {
-        auto port = get_input_port(e.portId);
-        if (!port) return; // unmodulated port
-
+        connected &= ~bit;
         port->set_mod_amount(0.f);
 
-        int i = 0;
-        for (auto port: ports) {
-            if (port.input_id >= 0 && module->getInput(port.input_id).isConnected()) {
-                mod_target = i;
-                auto pq = module->getParamQuantity(mod_param);
-                if (pq) {
-                    pq->setImmediateValue(port.modulation_amount());
-                }
-                return;
+        if (connected) {
+            int i = 0;
+            while (!input_connected(i)) ++i;
+            mod_target = i;
+            auto pq = module->getParamQuantity(mod_param);
+            if (pq) {
+                pq->setImmediateValue(ports[i].modulation_amount());
             }
-            ++i;
+            return;
         }
         mod_target = -1;
         auto pq = module->getParamQuantity(mod_param);
@@ -191,63 +312,23 @@ void Modulation::set_modulation_target(int target)
 void Modulation::sync_send()
 {
     if (!module->chem_host) return;
-    if (have_stream) {
-        uint8_t stream{INVALID_STREAM};
-        std::vector<PackedMidiMessage> stream_data;
-
-        // pass 1: send all plain CCs and capture stream
-        for (auto pit = ports.begin(); pit != ports.end(); pit++) {
-            switch (pit->kind) {
-            case PortKind::NoSend:
-                continue;
-
-            case PortKind::CC:
-                pit->pull_param_cv(module);
-                pit->send(module->chem_host, client_tag);
-                break;
-
-            case PortKind::Stream:
-                if (stream == INVALID_STREAM) {
-                    stream = pit->channel_stream;
-                } else {
-                    assert(stream == pit->channel_stream); // multiple streams in one modulation not implemented
-                }
-                pit->pull_param_cv(module);
-                if (pit->pending()) {
-                    stream_data.push_back(MakeStreamData(client_tag, pit->cc_id, pit->em_low()));
-                    pit->un_pend();
-                }
-                break;
-
-            case PortKind::StreamIndex:
-                if (stream == INVALID_STREAM) {
-                    stream = pit->channel_stream;
-                } else {
-                    assert(stream == pit->channel_stream); // multiple streams in one modulation not implemented
-                }
-                pit->set_param_and_em(module->getParam(pit->param_id).getValue());
-                if (pit->pending()) {
-                    stream_data.push_back(MakeStreamData(client_tag, pit->cc_id, pit->em_value & 0xf));
-                    pit->un_pend();
-                }
-                break;
-
-            default:
-                assert(false);
-            }
-        }
-        // pass 2: send pending data stream
-        assert (stream != INVALID_STREAM);
-        if (!stream_data.empty()) {
-            auto haken{module->chem_host->host_haken()};
-            assert(haken);
-            haken->send_stream(client_tag, stream, stream_data);
-        }
-    } else {
-        for (auto pit = ports.begin(); pit != ports.end(); pit++) {
-            pit->pull_param_cv(module);
-            pit->send(module->chem_host, client_tag);
+    PerfScope perf(perf_sync);
+    // stream pokes are batched by the host's HakenMidi, so every kind sends the same way
+    for (auto pit = ports.begin(); pit != ports.end(); pit++) {
+        switch (pit->kind) {
+        case PortKind::NoSend:
+            continue;
+        case PortKind::StreamIndex:
+            pit->pull_param(module);
+            break;
+        default:
+            pull_port(*pit);
+            break;
         }
+        // a change held in the deadband goes out once the CV stops moving
+        bool flush = settled && pit->held_in_deadband();
+        if (pit->pending() || flush) { perf_sent.add(); } else if (pit->held()) { perf_held.add(); }
+        pit->send(module->chem_host, client_tag, flush);
     }
 }
 
@@ -268,12 +349,10 @@ void Modulation::pull_mod_amount()
 void Modulation::update_mod_lights()
 {
     if (last_mod_target != mod_target) {
-        int i = 0;
-        for (auto port: ports) {
+        for (auto& port: ports) {
             if (port.light_id >= 0) {
-                module->getLight(port.light_id).setSmoothBrightness((i == mod_target) ? 1.f : 0.f, 90);
+                module->getLight(port.light_id).setSmoothBrightness((port.index == mod_target) ? 1.f : 0.f, 90);
             }
-            ++i;
         }
         last_mod_target = mod_target;
     }
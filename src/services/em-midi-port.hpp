@@ -55,6 +55,10 @@ struct EmccPortConfig
     }
 };
 
+// Changes smaller than this (14-bit units) are not sent while CV modulates a port,
+// until the CV settles. Fixed for all ports: 4 is a quarter of a 7-bit step.
+const uint16_t MOD_DEADBAND = 4;
+
 struct EmControlPort
 {
     float param_value{0.f};
@@ -68,6 +72,7 @@ struct EmControlPort
     uint8_t channel_stream{UNSET_8};
     uint8_t cc_id{UNSET_8};
     bool low_resolution{false};
+    int8_t last_direction{0};
     int param_id{-1};
     int input_id{-1};
     int light_id{-1};
@@ -107,8 +112,19 @@ struct EmControlPort
     bool is_stream_poke() { return PortKind::Stream == kind || PortKind::StreamIndex == kind; }
     bool is_cc() { return PortKind::CC == kind; }
 
-    bool pending() { return (em_value != last_em_value) && (UNSET_16 != last_em_value); }
-    void un_pend() { last_em_value = em_value; }
+    bool pending();
+    // changed, but within the deadband (or below the port's resolution)
+    bool held() { return (em_value != last_em_value) && (UNSET_16 != last_em_value) && !pending(); }
+    // changed within the deadband, which is worth sending once the CV settles
+    bool held_in_deadband() { return !low_resolution && held(); }
+    void un_pend() {
+        if ((em_value != last_em_value) && (UNSET_16 != last_em_value)) {
+            last_direction = (em_value > last_em_value) ? 1 : -1;
+        }
+        last_em_value = em_value;
+    }
+    // smallest change in em value that is sent
+    uint16_t send_step();
 
     uint16_t em() { return em_value; }
     uint8_t em_low() { return em_value >> 7; }
@@ -117,6 +133,7 @@ struct EmControlPort
     float modulation_amount() { return mod_amount; }
 
     void pull_param_cv(Module* module);
+    void pull_param(Module* module);
     void set_mod_amount(float amount);
     void set_param_and_em(float value);
     void set_em_and_param(uint16_t u14);
@@ -132,7 +149,14 @@ struct EmControlPort
     void send(IChemHost* chem, ChemId tag, bool force = false);
 };
 
+// Sending modulation: CV is smoothed every sample, and sent at up to
+// MOD_MIDI_FAST_RATE while it moves, otherwise every MOD_MIDI_RATE (knob changes).
 const float MOD_MIDI_RATE = 0.05f;
+const float MOD_MIDI_FAST_RATE = 0.01f;
+// two one-pole stages, well under the 50Hz Nyquist of the fastest send rate
+const float MOD_CV_CUTOFF = 20.f;
+// back off to MOD_MIDI_RATE when the host's MIDI output queue is this full
+const float MOD_MIDI_CONGESTED = 0.25f;
 
 struct Modulation
 {
@@ -147,24 +171,48 @@ struct Modulation
 
     rack::dsp::Timer midi_timer;
 
+    PerfCounter perf_sent;
+    PerfCounter perf_held;
+    PerfCounter perf_fast_sync;
+    PerfTimer perf_sync;
+
+    // smoothed CV, four ports per lane
+    std::vector<int> cv_inputs;
+    std::vector<simd::float_4> cv_stage1;
+    std::vector<simd::float_4> cv_stage2;
+    float cv_sample_time{0.f};
+    float cv_k{0.f};
+    void filter_cv(float sample_time);
+    float filtered_cv(int index) { return cv_stage2[index >> 2][index & 3]; }
+    bool cv_moved();
+    bool cv_moving();
+    // the last MOD_MIDI_RATE tick found the smoothed CV still, so values held in the deadband are sent
+    bool settled{false};
+    void pull_port(EmControlPort& port);
+
+    // Smooths CV, so call it every sample, before any early return that skips sending.
     bool sync_params_ready(const rack::engine::Module::ProcessArgs& args, float rate = MOD_MIDI_RATE);
 
     std::vector<EmControlPort> ports;
+    // module param/input/light id -> port index, -1 when the id has no port
+    std::vector<int> param_ports;
+    std::vector<int> input_ports;
+    std::vector<int> light_ports;
+    // bit per port index: the port's CV input is connected (kept by onPortChange)
+    uint64_t connected{0};
+
     EmControlPort& get_port(int index) {
         return ports[index];
     }
-    EmControlPort* get_param_port(int param_id) {
-        auto it = std::find_if(ports.begin(), ports.end(), [=](EmControlPort& port){ return port.param_id == param_id; });
-        return (it == ports.end()) ? nullptr : &*it;
-    }
-    EmControlPort* get_input_port(int input_id) {
-        auto it = std::find_if(ports.begin(), ports.end(), [=](EmControlPort& port){ return port.input_id == input_id; });
-        return (it == ports.end()) ? nullptr : &*it;
-    }
-    EmControlPort* get_light_port(int light_id) {
-        auto it = std::find_if(ports.begin(), ports.end(), [=](EmControlPort& port){ return port.light_id == light_id; });
-        return (it == ports.end()) ? nullptr : &*it;
+    EmControlPort* port_of(const std::vector<int>& index, int id) {
+        if (id < 0 || id >= static_cast<int>(index.size())) return nullptr;
+        int i = index[id];
+        return (i < 0) ? nullptr : &ports[i];
     }
+    EmControlPort* get_param_port(int param_id) { return port_of(param_ports, param_id); }
+    EmControlPort* get_input_port(int input_id) { return port_of(input_ports, input_id); }
+    EmControlPort* get_light_port(int light_id) { return port_of(light_ports, light_id); }
+    bool input_connected(int index) { return 0 != (connected & (uint64_t(1) << index)); }
 
     Modulation(ChemModule* module, ChemId client_tag);
 
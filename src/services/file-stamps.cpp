@@ -0,0 +1,30 @@
+// Copyright (C) Paul Chase Dempsey
+#include "file-stamps.hpp"
+#include <sys/stat.h>
+
+namespace pachde {
+
+int64_t file_mtime(const std::string& path)
+{
+    struct stat info;
+    if (0 != stat(path.c_str(), &info)) return 0;
+    return static_cast<int64_t>(info.st_mtime);
+}
+
+void FileStamps::stamp(const std::string& path)
+{
+    if (stamps.find(path) != stamps.end()) return;
+    stamps[path] = file_mtime(path);
+}
+
+bool FileStamps::changed(const std::string& path)
+{
+    auto it = stamps.find(path);
+    if (it == stamps.end()) return false;
+    auto time = file_mtime(path);
+    if (!time || (time == it->second)) return false;
+    it->second = time;
+    return true;
+}
+
+}
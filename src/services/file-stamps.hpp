@@ -0,0 +1,26 @@
+// Copyright (C) Paul Chase Dempsey
+#pragma once
+#include <rack.hpp>
+
+namespace pachde {
+
+// Last-modified time of a file, or 0 if it can't be read
+int64_t file_mtime(const std::string& path);
+
+// Remembers the modification time of files as they're loaded,
+// so a hot-reload can find just the ones that have changed on disk since.
+struct FileStamps
+{
+    std::map<std::string, int64_t> stamps;
+
+    // record the file's current time (a file already stamped is left alone)
+    void stamp(const std::string& path);
+    void forget(const std::string& path) { stamps.erase(path); }
+    void clear() { stamps.clear(); }
+
+    // True if the file changed since it was stamped, and restamps it.
+    // A file that was never stamped is reported unchanged.
+    bool changed(const std::string& path);
+};
+
+}
@@ -11,8 +11,15 @@ void HakenMidi::key_pressure(ChemId tag, uint8_t channel, uint8_t note, uint8_t
     send_message(Tag(MakePolyKeyPressure(channel, note, pressure), tag));
 }
 
+static bool is_poke_stream(uint8_t stream)
+{
+    return in_range(stream, U8(Haken::s_Form_Poke), U8(Haken::s_Conv_Poke));
+}
+
 void HakenMidi::begin_stream(ChemId tag, uint8_t stream)
 {
+    // batched pokes go first, so they can't land in the middle of this stream
+    if (poke_count) flush_stream_pokes();
     send_message(Tag(MakeCC(Haken::ch16, Haken::ccStream, stream), tag));
 }
 void HakenMidi::stream_data(ChemId tag,uint8_t d1, uint8_t d2)
@@ -27,16 +34,59 @@ void HakenMidi::end_stream(ChemId tag)
 void HakenMidi::send_stream(ChemId tag, uint8_t stream, std::vector<PackedMidiMessage> &data)
 {
     if (data.empty()) return;
+    if (is_poke_stream(stream)) {
+        for (auto msg: data) {
+            poke_stream(tag, stream, msg.bytes.data1, msg.bytes.data2);
+        }
+        return;
+    }
 
     begin_stream(tag, stream);
     for (auto msg: data) {
         send_message(msg);
     }
-    if (!in_range(stream, U8(Haken::s_Form_Poke), U8(Haken::s_Conv_Poke))) {
+    if (!is_poke_stream(stream)) {
         end_stream(tag);
     }
 }
 
+void HakenMidi::poke_stream(ChemId tag, uint8_t stream, uint8_t id, uint8_t value)
+{
+    assert(is_poke_stream(stream));
+    auto data = MakeStreamData(tag, id, value);
+    for (int i = 0; i < poke_count; ++i) {
+        auto& poke = pokes[i];
+        if (poke.stream == stream && poke.data.bytes.data1 == id) {
+            poke.data = data;
+            return;
+        }
+    }
+    if (poke_count == MAX_POKES) {
+        flush_stream_pokes();
+    }
+    pokes[poke_count++] = StreamPoke{stream, data};
+}
+
+void HakenMidi::flush_stream_pokes()
+{
+    if (!poke_count) return;
+    int count = poke_count;
+    poke_count = 0;
+    uint8_t done[MAX_POKES]{0};
+    for (int i = 0; i < count; ++i) {
+        if (done[i]) continue;
+        uint8_t stream = pokes[i].stream;
+        // poke streams need no end_stream
+        send_message(Tag(MakeCC(Haken::ch16, Haken::ccStream, stream), static_cast<ChemId>(pokes[i].data.bytes.tag)));
+        for (int j = i; j < count; ++j) {
+            if (!done[j] && pokes[j].stream == stream) {
+                send_message(pokes[j].data);
+                done[j] = 1;
+            }
+        }
+    }
+}
+
 void HakenMidi::disable_recirculator(ChemId tag, bool disable)
 {
     begin_stream(tag, Haken::s_Mat_Poke);
@@ -16,6 +16,17 @@ struct HakenMidi
     bool tick_tock{true};
     bool osmose_target{false};
 
+    // Pokes (id,value streams s_Form_Poke..s_Conv_Poke) from all clients of the host
+    // are collected here, latest value per stream and id, and sent once per
+    // dispatch window as one begin/data.../end sequence per stream.
+    struct StreamPoke {
+        uint8_t stream;
+        PackedMidiMessage data;
+    };
+    static const int MAX_POKES = 64;
+    StreamPoke pokes[MAX_POKES];
+    int poke_count{0};
+
     HakenMidi(const HakenMidi&) = delete; // no copy constructor
     HakenMidi(){}
 
@@ -24,6 +35,7 @@ struct HakenMidi
     //void set_matrix(EaganMatrix* the_matrix) { matrix = the_matrix; }
 
     void send_message(PackedMidiMessage msg) { doer->do_message(msg); }
+    void send_messages(const PackedMidiMessage* messages, size_t count) { doer->do_messages(messages, count); }
 
     void control_change(ChemId tag, uint8_t channel, uint8_t cc, uint8_t value);
     void key_pressure(ChemId tag, uint8_t channel, uint8_t note, uint8_t pressure);
@@ -32,6 +44,10 @@ struct HakenMidi
     void stream_data(ChemId tag, uint8_t d1, uint8_t d2);
     void end_stream(ChemId tag);
     void send_stream(ChemId tag, uint8_t stream, std::vector<PackedMidiMessage>& data);
+    void poke_stream(ChemId tag, uint8_t stream, uint8_t id, uint8_t value);
+    void flush_stream_pokes();
+    // drop collected pokes unsent, with the output queue they were headed for
+    void clear_stream_pokes() { poke_count = 0; }
 
     void select_preset(ChemId tag, eaganmatrix::PresetId id);
     void extended_macro(ChemId tag, uint8_t macro, uint16_t value);
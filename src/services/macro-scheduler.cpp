@@ -0,0 +1,73 @@
+// Copyright (C) Paul Chase Dempsey
+#include "macro-scheduler.hpp"
+#include "haken-midi.hpp"
+
+namespace pachde {
+
+void MacroScheduler::post(ChemId tag, uint8_t macro, uint16_t value)
+{
+    if (macro < FIRST_MACRO || macro > LAST_MACRO) return;
+    uint32_t slot = DIRTY | (uint32_t(as_u8(tag)) << 16) | (value & 0x3fff);
+    auto prev = slots[macro].exchange(slot, std::memory_order_relaxed);
+    if (prev & DIRTY) {
+        perf_coalesced.add();
+    }
+    perf_posted.add();
+    any_dirty.store(true, std::memory_order_release);
+}
+
+void MacroScheduler::clear()
+{
+    for (auto& slot: slots) {
+        slot.store(0, std::memory_order_relaxed);
+    }
+    any_dirty.store(false, std::memory_order_relaxed);
+    cursor = FIRST_MACRO;
+    timer.reset();
+}
+
+bool MacroScheduler::tick(float sample_time)
+{
+    if (timer.process(sample_time) > TICK_SECONDS) {
+        timer.reset();
+        return true;
+    }
+    return false;
+}
+
+int MacroScheduler::send(HakenMidi* haken)
+{
+    if (!any_dirty.exchange(false, std::memory_order_acquire)) return 0;
+
+    const int span = LAST_MACRO - FIRST_MACRO + 1;
+    int sent = 0;
+    uint8_t macro = cursor;
+    for (int n = 0; n < span; ++n) {
+        if (sent >= MAX_PER_TICK) {
+            // leave the rest for the next tick
+            any_dirty.store(true, std::memory_order_relaxed);
+            break;
+        }
+        auto& slot = slots[macro];
+        if (slot.load(std::memory_order_relaxed) & DIRTY) {
+            auto value = slot.exchange(0, std::memory_order_relaxed);
+            if (value & DIRTY) {
+                haken->extended_macro(as_chem_id((value >> 16) & 0xff), macro, value & 0x3fff);
+                ++sent;
+            }
+        }
+        macro = (macro >= LAST_MACRO) ? FIRST_MACRO : macro + 1;
+    }
+    cursor = macro;
+    perf_sent.add(sent);
+    return sent;
+}
+
+void MacroScheduler::register_perf(PerfGroup& group, const std::string& prefix)
+{
+    group.add(prefix + ".posted", &perf_posted);
+    group.add(prefix + ".coalesced", &perf_coalesced);
+    group.add(prefix + ".sent", &perf_sent);
+}
+
+}
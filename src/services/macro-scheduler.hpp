@@ -0,0 +1,52 @@
+// Copyright (C) Paul Chase Dempsey
+#pragma once
+#include <rack.hpp>
+#include <atomic>
+#include "chem-id.hpp"
+#include "perf-counters.hpp"
+
+namespace pachde {
+
+struct HakenMidi;
+
+// Per-device scheduler for extended macro values.
+//
+// Clients (on any engine thread) post the latest value for a macro number.
+// A later post for the same macro replaces one that hasn't been sent yet,
+// so several XMs and Overlays driving the same macros don't multiply the traffic.
+// The host sends whatever is dirty once per tick, at most MAX_PER_TICK macros,
+// picking up where it left off on the next tick so no macro is starved.
+struct MacroScheduler
+{
+    static constexpr const uint8_t FIRST_MACRO = 7;
+    static constexpr const uint8_t LAST_MACRO = 90;
+    static constexpr const int MAX_PER_TICK = 16;
+    static constexpr const float TICK_SECONDS = 0.05f;
+
+    // slot layout: dirty bit | tag << 16 | 14-bit value
+    static constexpr const uint32_t DIRTY = 0x80000000;
+
+    std::atomic<uint32_t> slots[LAST_MACRO + 1];
+    std::atomic<bool> any_dirty{false};
+    uint8_t cursor{FIRST_MACRO};
+    rack::dsp::Timer timer;
+
+    PerfCounter perf_posted;
+    PerfCounter perf_coalesced;
+    PerfCounter perf_sent;
+
+    MacroScheduler(const MacroScheduler&) = delete;
+    MacroScheduler() { clear(); }
+
+    // engine threads
+    void post(ChemId tag, uint8_t macro, uint16_t value);
+
+    // host only
+    void clear();
+    bool tick(float sample_time);
+    int send(HakenMidi* haken);
+
+    void register_perf(PerfGroup& group, const std::string& prefix);
+};
+
+}
@@ -193,6 +193,13 @@ std::string MidiDeviceConnectionInfo::friendly(NameFormat length) const
     return result;
 }
 
+bool is_EMConnection(const MidiDeviceConnectionInfo& info)
+{
+    return !ExcludeDriver(info.driver_name)
+        && is_EMDevice(info.input_device_name)
+        && is_EMDevice(info.output());
+}
+
 std::vector<std::shared_ptr<MidiDeviceConnection>> EnumerateMidiConnections(bool emOnly)
 {
     std::vector<std::shared_ptr<MidiDeviceConnection>> result;
@@ -208,9 +215,6 @@ std::vector<std::shared_ptr<MidiDeviceConnection>> EnumerateMidiConnections(bool
         // collect inputs
         for (auto id_input: driver->getInputDeviceIds()) {
             auto input_name = FilterDeviceName(driver->getInputDeviceName(id_input));
-            if (emOnly && !is_EMDevice(input_name)) {
-                continue;
-            }
             auto item = std::make_shared<MidiDeviceConnection>();
             item->driver_id = id_driver;
             item->input_device_id = id_input;
@@ -228,7 +232,7 @@ std::vector<std::shared_ptr<MidiDeviceConnection>> EnumerateMidiConnections(bool
         counts.clear();
         for (auto id_out: driver->getOutputDeviceIds()) {
             auto output_name = FilterDeviceName(driver->getOutputDeviceName(id_out));
-            if (ExcludeDevice(output_name) || (emOnly && !is_EMDevice(output_name))) {
+            if (ExcludeDevice(output_name)) {
                 continue;
             }
             auto r = counts.insert(std::make_pair(output_name, 0));
@@ -251,6 +255,12 @@ std::vector<std::shared_ptr<MidiDeviceConnection>> EnumerateMidiConnections(bool
             // }
         }
     }
+    if (emOnly) {
+        // sequence numbers count by device name, so filtering by name afterwards leaves EM claims unchanged
+        result.erase(std::remove_if(result.begin(), result.end(), [](const std::shared_ptr<MidiDeviceConnection>& item) {
+            return !is_EMConnection(item->info);
+        }), result.end());
+    }
     return result;
 }
 
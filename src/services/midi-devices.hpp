@@ -2,6 +2,10 @@
 #pragma once
 #include <rack.hpp>
 #include <string>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include "misc.hpp"
 #include "chem-id.hpp"
 
@@ -78,8 +82,24 @@ struct MidiDeviceConnection
     }
 };
 
+// an EaganMatrix input and output on a usable driver
+bool is_EMConnection(const MidiDeviceConnectionInfo& info);
 std::vector<std::shared_ptr<MidiDeviceConnection>> EnumerateMidiConnections(bool emOnly);
 
+// Immutable result of one enumeration.
+// Claims are generated before the snapshot is published, so readers on any thread
+// never write the connection's on-demand claim_spec.
+struct MidiDeviceSnapshot
+{
+    uint64_t generation{0};
+    std::vector<std::shared_ptr<MidiDeviceConnection>> connections; // in enumeration order
+    std::vector<std::shared_ptr<MidiDeviceConnection>> by_claim;
+
+    explicit MidiDeviceSnapshot(std::vector<std::shared_ptr<MidiDeviceConnection>> && list);
+    std::shared_ptr<MidiDeviceConnection> find(const std::string& claim) const;
+    bool same_devices(const MidiDeviceSnapshot* other) const;
+};
+
 struct IMidiDeviceNotify;
 
 struct MidiDeviceHolder
@@ -118,7 +138,24 @@ struct MidiDeviceBroker
 
     std::vector<MidiDeviceHolder*> holders;
 
+    // Enumeration runs on a background thread (driver queries can take many ms),
+    // and publishes a new snapshot only when the set of devices changes.
+    // It is the only caller of EnumerateMidiConnections, so driver queries never overlap.
+    std::shared_ptr<const MidiDeviceSnapshot> snapshot{nullptr};
+    std::thread enumerator;
+    std::mutex enumerate_lock;
+    std::condition_variable enumerate_signal;
+    std::atomic<bool> enumerate_requested{false};
+    std::atomic<bool> stopping{false};
+
+    // A sync takes a ticket; the worker marks the ticket served once an enumeration
+    // that started after the request completes, and poll_sync reconciles then.
+    std::atomic<uint64_t> sync_ticket{0};
+    std::atomic<uint64_t> served_ticket{0};
+    std::atomic<uint64_t> reconciled_ticket{0};
+
     MidiDeviceBroker();
+    ~MidiDeviceBroker();
     static std::shared_ptr<MidiDeviceBroker> get();
 
     bool is_primary(MidiDeviceHolder* holder);
@@ -126,7 +163,19 @@ struct MidiDeviceBroker
     void unRegisterDeviceHolder(MidiDeviceHolder* holder);
     void clear();
     bool available(const std::string& claim);
+    // request a fresh enumeration (non-blocking)
+    void refresh();
+    // latest published snapshot, or null before the first enumeration completes
+    std::shared_ptr<const MidiDeviceSnapshot> devices();
+    // request an enumeration and a reconcile of holders with its result (non-blocking)
     void sync();
+    // true when no sync is waiting on an enumeration, so devices() is current
+    bool synced() { return served_ticket >= sync_ticket; }
+    // true when holders have also been reconciled with that enumeration
+    bool reconciled() { return synced() && reconciled_ticket >= served_ticket; }
+    // reconcile holders once a requested enumeration has completed.
+    // Call regularly from one thread (the primary Core's process).
+    bool poll_sync();
     bool bindAvailableEm(MidiDeviceHolder* holder);
 };
 
@@ -122,12 +122,15 @@ void MidiInput::dispatch(float sampleTime)
         midi_timer.reset();
     }
 
+    if (ring.empty()) return;
+    PerfScope perf(perf_dispatch);
     while (!ring.empty()) {
         auto message = ring.shift();
         if (log) {
             log->logMidi(IO_Direction::In, message);
         }
         ++message_count;
+        perf_messages.add();
         target->do_message(message);
     }
 }
@@ -141,6 +144,15 @@ void MidiInput::drop(int count)
         log->log_message(printable(source_name), buffer);
     }
     ring.shiftBuffer(trash, count);
+    perf_dropped.add(count);
+}
+
+void MidiInput::register_perf(PerfGroup& group, const std::string& prefix)
+{
+    group.add(prefix + ".messages", &perf_messages);
+    group.add(prefix + ".dropped", &perf_dropped);
+    group.add(prefix + ".queue-peak", &perf_queue_peak);
+    group.add(prefix + ".dispatch", &perf_dispatch);
 }
 
 MidiInput::MidiInput(ChemId tag):
@@ -160,6 +172,7 @@ void MidiInput::queueMessage(PackedMidiMessage msg)
         drop(16);
     }
     ring.push(msg);
+    perf_queue_peak.peak(ring.size());
 }
 
 void MidiInput::enable(bool enabled)
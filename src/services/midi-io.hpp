@@ -2,6 +2,7 @@
 #pragma once
 #include <rack.hpp>
 #include "midi-log.hpp"
+#include "perf-counters.hpp"
 //#include "chem-core.hpp"
 #include "chem-id.hpp"
 
@@ -39,6 +40,13 @@ struct MidiInput : midi::Input
     void dispatch(float sampleTime);
     void drop(int count);
     rack::dsp::Timer midi_timer;
+
+    PerfCounter perf_messages;
+    PerfCounter perf_dropped;
+    PerfCounter perf_queue_peak;
+    PerfTimer perf_dispatch;
+    void register_perf(PerfGroup& group, const std::string& prefix);
+
     MidiInput(const MidiInput &) = delete; // no copy constructor
     MidiInput(ChemId tag);
 
@@ -0,0 +1,154 @@
+// Copyright (C) Paul Chase Dempsey
+#include "perf-counters.hpp"
+#include "my-plugin.hpp"
+#include "text.hpp"
+
+namespace pachde {
+
+void PerfTimer::record(uint64_t ns)
+{
+    calls.fetch_add(1, std::memory_order_relaxed);
+    total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t current = max_ns.load(std::memory_order_relaxed);
+    while (ns > current && !max_ns.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {}
+}
+
+double PerfTimer::mean_us() const
+{
+    auto n = count();
+    return n ? (total_ns.load(std::memory_order_relaxed) / 1000.0) / n : 0.0;
+}
+
+void PerfTimer::reset()
+{
+    calls.store(0, std::memory_order_relaxed);
+    total_ns.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+}
+
+// ----  PerfGroup  ----------------------------
+
+PerfGroup::PerfGroup(rack::engine::Module* module, const char* name) :
+    module(module),
+    name(name)
+{
+    PerfRegistry::get()->register_group(this);
+}
+
+PerfGroup::~PerfGroup()
+{
+    PerfRegistry::get()->unregister_group(this);
+}
+
+std::string PerfGroup::display_name() const
+{
+    if (!module || !module->model) return name;
+    if (name.empty()) {
+        return format_string("%s #%lld", module->model->name.c_str(), static_cast<long long>(module->id));
+    }
+    return format_string("%s %s #%lld", module->model->name.c_str(), name.c_str(), static_cast<long long>(module->id));
+}
+
+void PerfGroup::reset()
+{
+    for (auto& entry: counters) {
+        entry.counter->reset();
+    }
+    for (auto& entry: timers) {
+        entry.timer->reset();
+    }
+}
+
+json_t* PerfGroup::toJson() const
+{
+    auto root = json_object();
+    json_object_set_new(root, "name", json_string(display_name().c_str()));
+    auto jcounters = json_object();
+    for (auto& entry: counters) {
+        json_object_set_new(jcounters, entry.name.c_str(), json_integer(entry.counter->get()));
+    }
+    json_object_set_new(root, "counters", jcounters);
+    auto jtimers = json_object();
+    for (auto& entry: timers) {
+        auto jt = json_object();
+        json_object_set_new(jt, "calls", json_integer(entry.timer->count()));
+        json_object_set_new(jt, "mean-us", json_real(entry.timer->mean_us()));
+        json_object_set_new(jt, "max-us", json_real(entry.timer->max_us()));
+        json_object_set_new(jt, "total-ms", json_real(entry.timer->total_ms()));
+        json_object_set_new(jtimers, entry.name.c_str(), jt);
+    }
+    json_object_set_new(root, "timers", jtimers);
+    return root;
+}
+
+// ----  PerfRegistry  ----------------------------
+
+std::atomic<bool> PerfRegistry::enabled{false};
+
+PerfRegistry* PerfRegistry::get()
+{
+    static PerfRegistry the_registry;
+    return &the_registry;
+}
+
+void PerfRegistry::register_group(PerfGroup* group)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (groups.cend() == std::find(groups.cbegin(), groups.cend(), group)) {
+        groups.push_back(group);
+    }
+}
+
+void PerfRegistry::unregister_group(PerfGroup* group)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto item = std::find(groups.cbegin(), groups.cend(), group);
+    if (item != groups.cend()) {
+        groups.erase(item);
+    }
+}
+
+void PerfRegistry::reset()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto group: groups) {
+        group->reset();
+    }
+}
+
+json_t* PerfRegistry::toJson()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto root = json_object();
+    json_object_set_new(root, "enabled", json_boolean(is_enabled()));
+    json_object_set_new(root, "time", json_string(rack::string::formatTimeISO(rack::system::getUnixTime()).c_str()));
+    auto jar = json_array();
+    for (auto group: groups) {
+        json_array_append_new(jar, group->toJson());
+    }
+    json_object_set_new(root, "groups", jar);
+    return root;
+}
+
+std::string PerfRegistry::default_path()
+{
+    return user_plugin_asset("perf-counters.json");
+}
+
+bool PerfRegistry::save(const std::string& path)
+{
+    auto dir = system::getDirectory(path);
+    system::createDirectories(dir);
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    DEFER({std::fclose(file);});
+    auto root = toJson();
+    if (!root) { return false; }
+    DEFER({json_decref(root);});
+    return json_dumpf(root, file, JSON_INDENT(2)) >= 0;
+}
+
+}
@@ -0,0 +1,108 @@
+// Copyright (C) Paul Chase Dempsey
+#pragma once
+#include <rack.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace pachde {
+
+// Lightweight performance counters.
+//
+// Counters and timers are plain members of the object being measured,
+// so updating them is a relaxed atomic op with no lookup.
+// A PerfGroup collects named pointers to them and registers itself with the
+// process-wide PerfRegistry, which is what the Core menu and JSON dump read.
+// Timers only run while the registry is enabled.
+
+struct PerfCounter
+{
+    std::atomic<uint64_t> value{0};
+
+    void add(uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+    // track a high-water mark, e.g. queue depth
+    void peak(uint64_t n) {
+        uint64_t current = value.load(std::memory_order_relaxed);
+        while (n > current && !value.compare_exchange_weak(current, n, std::memory_order_relaxed)) {}
+    }
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+    void reset() { value.store(0, std::memory_order_relaxed); }
+};
+
+struct PerfTimer
+{
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> max_ns{0};
+
+    void record(uint64_t ns);
+    uint64_t count() const { return calls.load(std::memory_order_relaxed); }
+    double mean_us() const;
+    double max_us() const { return max_ns.load(std::memory_order_relaxed) / 1000.0; }
+    double total_ms() const { return total_ns.load(std::memory_order_relaxed) / 1000000.0; }
+    void reset();
+};
+
+struct PerfRegistry;
+
+struct PerfGroup
+{
+    struct CounterEntry { std::string name; PerfCounter* counter; };
+    struct TimerEntry { std::string name; PerfTimer* timer; };
+
+    // The owning module supplies the displayed name (model and instance),
+    // resolved when reported because a module isn't named until it's in the engine.
+    rack::engine::Module* module{nullptr};
+    std::string name;
+    std::vector<CounterEntry> counters;
+    std::vector<TimerEntry> timers;
+
+    PerfGroup(rack::engine::Module* module, const char* name);
+    ~PerfGroup();
+    PerfGroup(const PerfGroup&) = delete;
+    PerfGroup& operator=(const PerfGroup&) = delete;
+
+    void add(const std::string& name, PerfCounter* counter) { counters.push_back(CounterEntry{name, counter}); }
+    void add(const std::string& name, PerfTimer* timer) { timers.push_back(TimerEntry{name, timer}); }
+    std::string display_name() const;
+    void reset();
+    json_t* toJson() const;
+};
+
+struct PerfRegistry
+{
+    static std::atomic<bool> enabled;
+    static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+    static void enable(bool on) { enabled.store(on, std::memory_order_relaxed); }
+
+    std::mutex lock;
+    std::vector<PerfGroup*> groups;
+
+    static PerfRegistry* get();
+
+    void register_group(PerfGroup* group);
+    void unregister_group(PerfGroup* group);
+    void reset();
+    json_t* toJson();
+    bool save(const std::string& path);
+    std::string default_path();
+};
+
+// Times the enclosing scope into a PerfTimer, when counters are enabled.
+struct PerfScope
+{
+    using clock = std::chrono::steady_clock;
+    PerfTimer* timer;
+    clock::time_point start;
+
+    explicit PerfScope(PerfTimer& t) : timer(PerfRegistry::is_enabled() ? &t : nullptr) {
+        if (timer) start = clock::now();
+    }
+    ~PerfScope() {
+        if (timer) {
+            timer->record(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+        }
+    }
+};
+
+}
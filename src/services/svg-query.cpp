@@ -13,16 +13,61 @@ namespace svg_query {
     return ::rack::math::Rect(INFINITY, INFINITY, 0, 0);
 }
 
+void BoundsIndex::set(const char * id, const ::rack::math::Rect& rect)
+{
+    auto it = std::lower_bound(items.begin(), items.end(), id,
+        [](const Item& item, const char * key) { return strcmp(item.id.c_str(), key) < 0; });
+    if ((it != items.end()) && (it->id == id)) {
+        it->rect = rect;
+    } else {
+        items.insert(it, Item{id, rect});
+    }
+}
+
+BoundsIndex::const_iterator BoundsIndex::find(const char * id) const
+{
+    auto it = std::lower_bound(items.cbegin(), items.cend(), id,
+        [](const Item& item, const char * key) { return strcmp(item.id.c_str(), key) < 0; });
+    return ((it != items.cend()) && (it->id == id)) ? it : items.cend();
+}
+
+::rack::math::Rect BoundsIndex::operator[](const char * id) const
+{
+    auto it = find(id);
+    return (it == end()) ? ::rack::math::Rect() : it->rect;
+}
+
+const ::rack::math::Rect& BoundsIndex::at(const char * id) const
+{
+    auto it = find(id);
+    if (it == end()) throw std::out_of_range(id);
+    return it->rect;
+}
+
+void BoundsIndex::sort()
+{
+    std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.id < b.id; });
+    // keep the last of each run of equal ids, as later additions replace earlier ones
+    std::vector<Item> unique;
+    unique.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        if ((i + 1 < items.size()) && (items[i].id == items[i + 1].id)) continue;
+        unique.push_back(std::move(items[i]));
+    }
+    items.swap(unique);
+}
+
 void addBounds(SharedSvg svg, const char *prefix, BoundsIndex &map, bool hide)
 {
     int len = strlen(prefix);
     for (NSVGshape* shape = svg->handle->shapes; nullptr != shape; shape = shape->next) {
         if (shape->id[0] && (0 == strncmp(shape->id, prefix, len))) {
             float * r = &shape->bounds[0];
-            map[std::string(shape->id)] = ::rack::math::Rect(*r, r[1], r[2] - *r, r[3] - r[1]);
+            map.items.push_back(BoundsIndex::Item{std::string(shape->id), ::rack::math::Rect(*r, r[1], r[2] - *r, r[3] - r[1])});
             if (hide) shape->opacity = 0.f;
         }
     }
+    map.sort();
 }
 
 BoundsIndex makeBounds(SharedSvg svg, const char *prefix, bool hide)
@@ -32,6 +77,48 @@ BoundsIndex makeBounds(SharedSvg svg, const char *prefix, bool hide)
     return bounds;
 }
 
+struct CachedBounds
+{
+    const ::rack::window::Svg* key;
+    std::weak_ptr<::rack::window::Svg> svg; // to notice an Svg freed and another allocated in its place
+    const NSVGimage* image;
+    std::string prefix;
+    bool hidden;
+    BoundsIndex bounds;
+};
+// A handful of entries: one per panel and theme in use. Entries are never moved, so references stay valid.
+static std::vector<std::unique_ptr<CachedBounds>> bounds_cache;
+
+const BoundsIndex& cachedBounds(SharedSvg svg, const char * prefix, bool hide)
+{
+    for (auto it = bounds_cache.begin(); it != bounds_cache.end(); ) {
+        CachedBounds* entry = it->get();
+        if (entry->svg.expired()) {
+            it = bounds_cache.erase(it);
+            continue;
+        }
+        if ((entry->key == svg.get()) && (entry->image == svg->handle) && (entry->prefix == prefix)) {
+            if (hide && !entry->hidden) {
+                hideElements(svg, prefix);
+                entry->hidden = true;
+            }
+            return entry->bounds;
+        }
+        ++it;
+    }
+    auto entry = new CachedBounds{svg.get(), svg, svg->handle, prefix, hide, BoundsIndex{}};
+    addBounds(svg, prefix, entry->bounds, hide);
+    bounds_cache.push_back(std::unique_ptr<CachedBounds>(entry));
+    return entry->bounds;
+}
+
+void forgetBounds(const ::rack::window::Svg* svg)
+{
+    bounds_cache.erase(
+        std::remove_if(bounds_cache.begin(), bounds_cache.end(), [svg](const std::unique_ptr<CachedBounds>& entry) { return entry->key == svg; }),
+        bounds_cache.end());
+}
+
 void shapeIndex(SharedSvg svg, const char *prefix, ShapeIndex& map)
 {
     int len = strlen(prefix);
@@ -95,6 +182,49 @@ SharedSvg panelWidgetSvg(::rack::widget::Widget* panel)
     return nullptr;
 }
 
+static void positionWidget(const HotPos& pos, const ::rack::math::Rect& r)
+{
+    using namespace ::rack::math;
+
+    auto widget = pos.widget;
+    switch (pos.kind) {
+    default:
+    case HotPosKind::Center:
+        widget->box.pos = r.getCenter().minus(widget->box.size.div(2));
+        break;
+    case HotPosKind::Box:
+        widget->box = r;
+        break;
+    case HotPosKind::BoundsCenter:
+        widget->box.pos = r.getCenter();
+        break;
+    case HotPosKind::TopLeft:
+        widget->box.pos = r.pos;
+        break;
+    case HotPosKind::TopMiddle:
+        widget->box.pos = Vec(r.pos.x + r.size.x*.5, r.pos.y);
+        break;
+    case HotPosKind::TopRight:
+        widget->box.pos = r.getTopRight();
+        break;
+    case HotPosKind::MiddleRight:
+        widget->box.pos = Vec(r.pos.x + r.size.x, r.pos.y + r.size.y*.5);
+        break;
+    case HotPosKind::BottomRight:
+        widget->box.pos = r.getBottomRight();
+        break;
+    case HotPosKind::BottomMiddle:
+        widget->box.pos = Vec(r.pos.x + r.size.x*.5, r.pos.y + r.size.y);
+        break;
+    case HotPosKind::BottomLeft:
+        widget->box.pos = r.getBottomLeft();
+        break;
+    case HotPosKind::MiddleLeft:
+        widget->box.pos = Vec(r.pos.x, r.pos.y + r.size.y*.5);
+        break;
+    }
+}
+
 void positionWidgets(const PositionIndex &positions, const BoundsIndex& bounds)
 {
     using namespace ::rack::math;
@@ -111,46 +241,28 @@ void positionWidgets(const PositionIndex &positions, const BoundsIndex& bounds)
 #else
         Rect r{bounds.at(kv.first)};
 #endif
-        auto widget = kv.second.widget;
-        switch (kv.second.kind) {
-        default:
-        case HotPosKind::Center:
-            widget->box.pos = r.getCenter().minus(widget->box.size.div(2));
-            break;
-        case HotPosKind::Box:
-            widget->box = r;
-            break;
-        case HotPosKind::BoundsCenter:
-            widget->box.pos = r.getCenter();
-            break;
-        case HotPosKind::TopLeft:
-            widget->box.pos = r.pos;
-            break;
-        case HotPosKind::TopMiddle:
-            widget->box.pos = Vec(r.pos.x + r.size.x*.5, r.pos.y);
-            break;
-        case HotPosKind::TopRight:
-            widget->box.pos = r.getTopRight();
-            break;
-        case HotPosKind::MiddleRight:
-            widget->box.pos = Vec(r.pos.x + r.size.x, r.pos.y + r.size.y*.5);
-            break;
-        case HotPosKind::BottomRight:
-            widget->box.pos = r.getBottomRight();
-            break;
-        case HotPosKind::BottomMiddle:
-            widget->box.pos = Vec(r.pos.x + r.size.x*.5, r.pos.y + r.size.y);
-            break;
-        case HotPosKind::BottomLeft:
-            widget->box.pos = r.getBottomLeft();
-            break;
-        case HotPosKind::MiddleLeft:
-            widget->box.pos = Vec(r.pos.x, r.pos.y + r.size.y*.5);
-            break;
-        }
+        positionWidget(kv.second, r);
     }
 }
 
+inline bool same_rect(const ::rack::math::Rect& a, const ::rack::math::Rect& b)
+{
+    return a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.size.x == b.size.x && a.size.y == b.size.y;
+}
+
+size_t positionChangedWidgets(const PositionIndex& positions, const BoundsIndex& before, const BoundsIndex& after)
+{
+    size_t count = 0;
+    for (auto kv: positions) {
+        auto now = after.find(kv.first);
+        if (now == after.end()) continue;
+        auto was = before.find(kv.first);
+        if ((was != before.end()) && same_rect(was->rect, now->rect)) continue;
+        positionWidget(kv.second, now->rect);
+        ++count;
+    }
+    return count;
+}
 }
 /*
 MIT License (MIT)
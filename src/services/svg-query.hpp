@@ -10,15 +10,56 @@ using SharedSvg = std::shared_ptr<::rack::window::Svg>;
 // Bounds are 4 floats [left, top, right, bottom]
 ::rack::math::Rect elementBounds(SharedSvg svg, const char* id);
 
-using BoundsIndex = std::map<std::string, ::rack::math::Rect>;
-// makeBounds creates an index (map[id:rect]) of all elements whose id has the specified prefix.
+// Element bounds by id, kept as a flat vector sorted by id for binary search.
+struct BoundsIndex
+{
+    struct Item {
+        std::string id;
+        ::rack::math::Rect rect;
+    };
+    std::vector<Item> items;
+
+    using const_iterator = std::vector<Item>::const_iterator;
+    const_iterator begin() const { return items.cbegin(); }
+    const_iterator end() const { return items.cend(); }
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    void clear() { items.clear(); }
+
+    // add or replace
+    void set(const char * id, const ::rack::math::Rect& rect);
+
+    const_iterator find(const char * id) const;
+    const_iterator find(const std::string& id) const { return find(id.c_str()); }
+
+    // Bounds of the element, or an empty Rect if it isn't in the index
+    ::rack::math::Rect operator[](const char * id) const;
+    ::rack::math::Rect operator[](const std::string& id) const { return (*this)[id.c_str()]; }
+
+    // Bounds of the element. Throws std::out_of_range if it isn't in the index.
+    const ::rack::math::Rect& at(const char * id) const;
+
+    // restore order after appending items, keeping the last of any duplicate id
+    void sort();
+};
+
+// makeBounds creates an index (id:rect) of all elements whose id has the specified prefix.
 BoundsIndex makeBounds(SharedSvg svg, const char * prefix, bool hide);
 
-// Add bounds to an existing map.
+// Add bounds to an existing index.
 // For creating common bounds index from multiple svgs.
 // Take care that all key names are unique across svgs.
 void addBounds(SharedSvg svg, const char * prefix, BoundsIndex& map, bool hide);
 
+// The bounds index for an Svg, built on first use and shared afterwards,
+// so each instance of a module doesn't walk the same panel again.
+// Panel Svgs are shared per file and theme, so that's how often an index is built.
+// The index is rebuilt if the Svg is reloaded.
+const BoundsIndex& cachedBounds(SharedSvg svg, const char * prefix, bool hide);
+
+// Drop any cached bounds for the Svg (before reloading it).
+void forgetBounds(const ::rack::window::Svg* svg);
+
 // shapeIndex creates an index (map[id:shape]) of all elements whose id has the specified prefix.
 using ShapeIndex = std::map<std::string, NSVGshape*>;
 void shapeIndex(SharedSvg svg, const char * prefix, ShapeIndex& map);
@@ -60,15 +101,19 @@ enum class HotPosKind {
 
 struct HotPos { HotPosKind kind; ::rack::widget::Widget* widget; };
 
-// indexed by svg id
-using PositionIndex = std::map<const char *, HotPos>;
+// indexed by svg id. More than one widget can follow a placeholder, e.g. a knob and its track.
+using PositionIndex = std::multimap<const char *, HotPos>;
 
 inline void addPosition(PositionIndex& positions, const char * key, HotPosKind kind, ::rack::widget::Widget* widget) {
-    positions[key] = HotPos{kind, widget};
+    positions.insert(std::make_pair(key, HotPos{kind, widget}));
 }
 
 void positionWidgets(const PositionIndex& positions, const BoundsIndex& bounds);
 
+// Reposition only the widgets whose placeholder bounds differ between two versions of the svg.
+// Returns the number of widgets moved.
+size_t positionChangedWidgets(const PositionIndex& positions, const BoundsIndex& before, const BoundsIndex& after);
+
 }
 
 /*
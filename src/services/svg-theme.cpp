@@ -1,7 +1,19 @@
 #include "svg-theme.hpp"
+#include "perf-counters.hpp"
+#include "svg-query.hpp"
 
 namespace svg_theme {
 
+// Theme application timing, in the performance counters
+pachde::PerfTimer perf_theme_plan;
+pachde::PerfTimer perf_theme_apply;
+struct ThemePerf : pachde::PerfGroup {
+    ThemePerf() : PerfGroup(nullptr, "SVG themes") {
+        add("plan", &perf_theme_plan);
+        add("apply", &perf_theme_apply);
+    }
+} theme_perf;
+
 const char * scanTag(const char * id)
 {
     if (!*id) return nullptr;
@@ -271,6 +283,53 @@ bool Style::applyStrokeWidth(NSVGshape *shape)
 // SvgTheme
 //
 
+struct TagTable
+{
+    std::unordered_map<std::string, uint32_t> index;
+    std::vector<std::string> names;
+};
+
+static TagTable& tag_table()
+{
+    static TagTable the_table;
+    return the_table;
+}
+
+uint32_t internTag(const char * tag)
+{
+    auto& table = tag_table();
+    std::string key(tag);
+    auto it = table.index.find(key);
+    if (it != table.index.end()) return it->second;
+    uint32_t index = static_cast<uint32_t>(table.names.size());
+    table.names.push_back(key);
+    table.index[key] = index;
+    return index;
+}
+
+const std::string& tagName(uint32_t index)
+{
+    return tag_table().names[index];
+}
+
+size_t tagCount()
+{
+    return tag_table().names.size();
+}
+
+Style* SvgTheme::styleForTag(uint32_t tag)
+{
+    if (tag >= tag_styles.size()) {
+        // resolve every tag interned since the last time
+        auto count = tagCount();
+        tag_styles.reserve(count);
+        for (size_t i = tag_styles.size(); i < count; ++i) {
+            tag_styles.push_back(getStyle(tagName(i)).get());
+        }
+    }
+    return tag_styles[tag];
+}
+
 std::shared_ptr<Style> SvgTheme::getStyle(const std::string &name)
 {
     auto found = styles.find(name);
@@ -313,11 +372,43 @@ bool SvgTheme::getStroke(PackedColor& result, const char *name, bool with_opacit
 // Theme application
 //
 
-bool applyImageTheme(NSVGimage* svg_handle, std::shared_ptr<SvgTheme> theme)
+void ThemeBindingPlan::build(NSVGimage* svg_handle)
 {
-    if (!theme || !svg_handle || !svg_handle->shapes) return false;
+    pachde::PerfScope perf_scope(perf_theme_plan);
+    built = true;
+    bindings.clear();
+    if (!svg_handle) return;
+    uint32_t ordinal = 0;
+    for (NSVGshape* shape = svg_handle->shapes; nullptr != shape; shape = shape->next, ++ordinal) {
+        const char * tag = scanTag(shape->id);
+        if (!tag || !*tag) continue;
+        bindings.push_back(Binding{ordinal, internTag(tag)});
+    }
+}
+
+bool ThemeBindingPlan::apply(NSVGimage* svg_handle, SvgTheme* theme) const
+{
+    if (!theme || !svg_handle) return false;
+    pachde::PerfScope perf_scope(perf_theme_apply);
     bool modified = false;
+    auto binding = bindings.cbegin();
+    uint32_t ordinal = 0;
+    for (NSVGshape* shape = svg_handle->shapes; (nullptr != shape) && (binding != bindings.cend()); shape = shape->next, ++ordinal) {
+        if (ordinal != binding->ordinal) continue;
+        Style* style = theme->styleForTag(binding->tag);
+        ++binding;
+        if (!style) continue;
+        if (style->applyFill(shape)) modified = true;
+        if (style->applyStroke(shape)) modified = true;
+        if (style->applyOpacity(shape)) modified = true;
+        if (style->applyStrokeWidth(shape)) modified = true;
+    }
+    return modified;
+}
 
+static bool applyImageThemeByName(NSVGimage* svg_handle, SvgTheme* theme)
+{
+    bool modified = false;
     for (NSVGshape* shape = svg_handle->shapes; nullptr != shape; shape = shape->next) {
         const char * tag = scanTag(shape->id);
         if (!tag || !*tag) continue;
@@ -331,6 +422,13 @@ bool applyImageTheme(NSVGimage* svg_handle, std::shared_ptr<SvgTheme> theme)
     return modified;
 }
 
+// One-off application: when the image is themed again, keep a ThemeBindingPlan instead.
+bool applyImageTheme(NSVGimage* svg_handle, std::shared_ptr<SvgTheme> theme)
+{
+    if (!theme || !svg_handle || !svg_handle->shapes) return false;
+    return applyImageThemeByName(svg_handle, theme.get());
+}
+
 //
 // SvgNoChache
 //
@@ -385,6 +483,160 @@ std::shared_ptr<::rack::window::Svg> RackSvgCache::reloadThemedSvg(const std::st
     return svg;
 }
 
+//
+// ThemedSvgCache
+//
+ThemedSvgCache* ThemedSvgCache::get()
+{
+    static ThemedSvgCache the_cache;
+    return &the_cache;
+}
+
+std::shared_ptr<::rack::window::Svg> ThemedSvgCache::acquire(const std::string& filename, std::shared_ptr<SvgTheme> theme)
+{
+    auto key = std::make_pair(filename, theme ? theme->name : std::string());
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        Entry& entry = it->second;
+        if (entry.theme != theme) {
+            // the theme was reloaded
+            applyTheme(filename, entry, theme);
+        }
+        return entry.svg;
+    }
+
+    if (entries.size() >= purge_threshold) {
+        purge();
+        purge_threshold = std::max(size_t(64), 2 * entries.size());
+    }
+
+    try {
+        auto svg = std::make_shared<::rack::window::Svg>();
+        stamps.stamp(filename);
+        svg->loadFile(filename);
+        hidePlaceholders(svg);
+        Entry& entry = entries[key];
+        entry.svg = svg;
+        applyTheme(filename, entry, theme);
+        return svg;
+    }
+    catch (rack::Exception& e) {
+        WARN("%s", e.what());
+        return nullptr;
+    }
+}
+
+void ThemedSvgCache::hidePlaceholders(std::shared_ptr<::rack::window::Svg> svg)
+{
+    if (!svg || !svg->handle) return;
+    for (auto& prefix : hidden_prefixes) {
+        svg_query::hideElements(svg, prefix.c_str());
+    }
+}
+
+void ThemedSvgCache::applyTheme(const std::string& filename, Entry& entry, std::shared_ptr<SvgTheme> theme)
+{
+    entry.theme = theme;
+    if (!theme || !entry.svg || !entry.svg->handle) return;
+    ThemeBindingPlan& plan = plans[filename];
+    if (!plan.built) {
+        // first themed copy, or the file was reloaded
+        plan.build(entry.svg->handle);
+    }
+    plan.apply(entry.svg->handle, theme.get());
+}
+
+bool ThemedSvgCache::reload(const std::string& filename)
+{
+    bool ok = true;
+    // the file's shapes may have changed
+    plans.erase(filename);
+    for (auto& item : entries) {
+        if (item.first.first != filename) continue;
+        Entry& entry = item.second;
+        svg_query::forgetBounds(entry.svg.get());
+        try {
+            entry.svg->loadFile(filename);
+            hidePlaceholders(entry.svg);
+            applyTheme(filename, entry, entry.theme);
+        } catch (Exception& e) {
+            WARN("%s", e.what());
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+std::vector<std::string> ThemedSvgCache::reloadChanged()
+{
+    std::vector<std::string> changed;
+    // entries are ordered by file, so each file is checked once
+    const std::string* previous{nullptr};
+    for (auto& item : entries) {
+        const std::string& filename = item.first.first;
+        if (previous && (*previous == filename)) continue;
+        previous = &filename;
+        if (stamps.changed(filename)) {
+            changed.push_back(filename);
+        }
+    }
+    for (auto& filename : changed) {
+        reload(filename);
+    }
+    return changed;
+}
+
+size_t ThemedSvgCache::purge()
+{
+    size_t count = 0;
+    for (auto it = entries.begin(); it != entries.end(); ) {
+        if (it->second.svg.use_count() <= 1) {
+            it = entries.erase(it);
+            ++count;
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = plans.begin(); it != plans.end(); ) {
+        auto entry = entries.lower_bound(std::make_pair(it->first, std::string()));
+        if ((entry == entries.end()) || (entry->first.first != it->first)) {
+            it = plans.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return count;
+}
+
+inline void rebind(std::shared_ptr<::rack::window::Svg>& svg, const SvgRebinding& rebinding)
+{
+    if (!svg) return;
+    auto it = rebinding.find(svg.get());
+    if (it != rebinding.end()) {
+        svg = it->second;
+    }
+}
+
+void rebindSvgs(Widget* widget, const SvgRebinding& rebinding)
+{
+    if (auto sw = dynamic_cast<::rack::widget::SvgWidget*>(widget)) {
+        rebind(sw->svg, rebinding);
+    } else if (auto panel = dynamic_cast<::rack::app::SvgPanel*>(widget)) {
+        rebind(panel->svg, rebinding);
+    } else if (auto svg_switch = dynamic_cast<::rack::app::SvgSwitch*>(widget)) {
+        for (auto& frame: svg_switch->frames) {
+            rebind(frame, rebinding);
+        }
+    } else if (auto button = dynamic_cast<::rack::app::SvgButton*>(widget)) {
+        for (auto& frame: button->frames) {
+            rebind(frame, rebinding);
+        }
+    }
+    for (Widget* child: widget->children) {
+        rebindSvgs(child, rebinding);
+    }
+}
+
 //
 // SvgCache
 //
@@ -395,28 +647,32 @@ std::shared_ptr<::rack::window::Svg> SvgCache::loadSvg(const std::string& filena
 		return pair->second;
     }
 
-    // Load svg
-	try {
-		auto svg = std::make_shared<::rack::window::Svg>();
-		svg->loadFile(filename);
+    auto svg = ThemedSvgCache::get()->acquire(filename, applied_theme);
+    if (svg) {
         svgs.insert(std::make_pair(filename, svg));
-        return svg;
-	}
-	catch (rack::Exception& e) {
-		WARN("%s", e.what());
-		return nullptr;
-	}
+    }
+    return svg;
 }
 
 void SvgCache::changeTheme(std::shared_ptr<SvgTheme> theme)
 {
     applied_theme = theme;
     if (!theme) return;
-    for (auto entry : svgs) {
-        if (entry.second) {
-            applySvgTheme(entry.second, theme);
+
+    auto shared = ThemedSvgCache::get();
+    SvgRebinding rebinding;
+    for (auto& entry : svgs) {
+        auto themed = shared->acquire(entry.first, theme);
+        if (themed && (themed != entry.second)) {
+            if (entry.second) {
+                rebinding[entry.second.get()] = themed;
+            }
+            entry.second = themed;
         }
     }
+    if (owner && !rebinding.empty()) {
+        rebindSvgs(owner, rebinding);
+    }
 }
 
 bool SvgCache::reload(const std::string &filename)
@@ -425,31 +681,16 @@ bool SvgCache::reload(const std::string &filename)
 	if (pair == svgs.end()) {
         WARN("SvgCache::reload: File not found: %s", filename.c_str());
         return false;
-    } else {
-        try {
-            pair->second->loadFile(filename);
-            if (applied_theme) {
-                applySvgTheme(pair->second, applied_theme);
-            }
-        } catch (Exception& e) {
-            WARN("%s", e.what());
-            return false;
-        }
     }
-    return true;
+    return ThemedSvgCache::get()->reload(filename);
 }
 
 bool SvgCache::reloadAll()
 {
     bool ok = true;
-    for (auto entry : svgs) {
-        try {
-            entry.second->loadFile(entry.first);
-            if (applied_theme) {
-                applySvgTheme(entry.second, applied_theme);
-            }
-        } catch (Exception& e) {
-            WARN("%s", e.what());
+    auto shared = ThemedSvgCache::get();
+    for (auto& entry : svgs) {
+        if (!shared->reload(entry.first)) {
             ok = false;
         }
     }
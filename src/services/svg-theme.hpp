@@ -3,6 +3,7 @@
 using namespace ::rack;
 #include <unordered_map>
 #include "packed-color.hpp"
+#include "file-stamps.hpp"
 using namespace ::packed_color;
 
 namespace svg_theme {
@@ -89,18 +90,47 @@ struct Style
     bool applyStrokeWidth(NSVGshape *shape);
 };
 
+// Style tags are interned process-wide, so binding plans and themes
+// can refer to a tag by index rather than by name.
+uint32_t internTag(const char * tag);
+const std::string& tagName(uint32_t index);
+size_t tagCount();
+
 struct SvgTheme
 {
     std::string name;
     std::string file;
     std::unordered_map<std::string, std::shared_ptr<Style>> styles;
 
+    // Styles by interned tag, resolved on first use.
+    // A theme's styles don't change once it's loaded.
+    std::vector<Style*> tag_styles;
+    Style* styleForTag(uint32_t tag);
+
     std::shared_ptr<Style> getStyle(const std::string &name);
     bool getGradient(const Gradient** result, const char *name);
     bool getFillColor(PackedColor& result, const char *name, bool with_opacity);
     bool getStroke(PackedColor& result, const char *name, bool with_opacity, float* width);
 };
 
+// One-time binding of a file's themeable shapes to interned style tags,
+// so applying a theme is a loop of paint writes with no tag scanning or string lookups.
+// Shapes are bound by position in the shape list, which depends only on the file,
+// so one plan serves every copy of the file, in every theme.
+struct ThemeBindingPlan
+{
+    struct Binding {
+        uint32_t ordinal;
+        uint32_t tag;
+    };
+    bool built{false};
+    std::vector<Binding> bindings;
+
+    void build(NSVGimage* svg_handle);
+    void clear() { built = false; bindings.clear(); }
+    bool apply(NSVGimage* svg_handle, SvgTheme* theme) const;
+};
+
 bool applyImageTheme(NSVGimage* svg_handle, std::shared_ptr<SvgTheme> theme);
 
 inline bool applySvgTheme(std::shared_ptr<::rack::window::Svg> svg, std::shared_ptr<SvgTheme> theme) {
@@ -148,21 +178,72 @@ struct RackSvgCache : ILoadSvg
     std::shared_ptr<::rack::window::Svg> reloadThemedSvg(const std::string& filename, std::shared_ptr<SvgTheme> theme);
 };
 
+// Process-wide cache of themed Svgs, keyed by (file, theme name).
+// Every module instance showing the same file in the same theme shares one
+// parsed and themed Svg, so it is parsed and themed once per process rather than per instance.
+// The shared Svgs must be treated as read-only by their users.
+// Entries that nobody else holds are evicted as the cache grows.
+// Placeholders (elements whose id starts with one of the hidden prefixes) are hidden
+// in every copy as it is loaded or reloaded, so no theme's copy ever shows them.
+// UI thread only.
+struct ThemedSvgCache
+{
+    struct Entry {
+        std::shared_ptr<::rack::window::Svg> svg;
+        std::shared_ptr<SvgTheme> theme; // theme applied, or nullptr for the unthemed file
+    };
+    std::map<std::pair<std::string, std::string>, Entry> entries;
+    std::map<std::string, ThemeBindingPlan> plans; // by file, shared by its themes
+    size_t purge_threshold{64};
+    ::pachde::FileStamps stamps;
+    std::vector<std::string> hidden_prefixes{"k:"};
+
+    void hidePlaceholders(std::shared_ptr<::rack::window::Svg> svg);
+    void applyTheme(const std::string& filename, Entry& entry, std::shared_ptr<SvgTheme> theme);
+
+    static ThemedSvgCache* get();
+
+    // Get the Svg for the file in the theme, loading and theming on first use.
+    std::shared_ptr<::rack::window::Svg> acquire(const std::string& filename, std::shared_ptr<SvgTheme> theme);
+
+    // "hot-reload" a file in every theme it's cached in
+    bool reload(const std::string& filename);
+
+    // "hot-reload" only the files modified since they were loaded, returning their names
+    std::vector<std::string> reloadChanged();
+
+    // evict entries that nobody else holds, returning the number evicted
+    size_t purge();
+    size_t size() { return entries.size(); }
+};
+
+// Old -> new Svg mapping for re-pointing widgets after a theme change
+using SvgRebinding = std::unordered_map<const ::rack::window::Svg*, std::shared_ptr<::rack::window::Svg>>;
+
+// Walks the Widget tree from `widget`, replacing the Svgs held by Svg widgets,
+// panels, switches and buttons according to the rebinding.
+void rebindSvgs(Widget* widget, const SvgRebinding& rebinding);
+
 // A local SVG cache can be used for a scope smaller than Rack-wide.
 // The cache can be per-plugin or per-module.
+// The Svgs themselves come from the shared ThemedSvgCache for the applied theme.
 struct SvgCache: ILoadSvg
 {
     std::map<std::string, std::shared_ptr<::rack::window::Svg>> svgs;
     std::shared_ptr<SvgTheme> applied_theme{nullptr};
 
+    // Widgets under the owner are re-pointed to the Svgs for a new theme
+    ::rack::widget::Widget* owner{nullptr};
+
     // Load a shared Svg
     std::shared_ptr<::rack::window::Svg> loadSvg(const std::string& filename) override;
 
-    // Apply a theme to the svgs in the cache.
+    // Switch the svgs in the cache to the theme, and re-point the owner's widgets to them.
     // Svg widgets will require an explicit refresh (marked dirty) because
     // they are normally cached with a framebuffer.
     // Widgets using multiple frames such as a Rack switch or latched button may
     // require logic to reset the frame before the theme change becomes visible.
+    // Svgs held outside the owner's widget tree must be re-loaded by their holder.
     void changeTheme(std::shared_ptr<SvgTheme> theme);
 
     // "hot-reload" one Svg
@@ -116,19 +116,38 @@ void RightAlignText(NVGcontext *vg, float x, float y, const char * text, const c
     nvgText(vg, x - bounds[2], y, text, end);
 }
 
+void TextLayout::measure(NVGcontext *vg, const std::string& str, int font, float size, float box_width)
+{
+    text = str;
+    font_handle = font;
+    font_size = size;
+    width = box_width;
+    rows.clear();
+
+    NVGtextRow text_rows[50];
+    const char * base = text.c_str();
+    int nrows = nvgTextBreakLines(vg, base, nullptr, width, text_rows, 50);
+    NVGtextRow* row = text_rows;
+    for (int n = 0; n < nrows; n++, row++) {
+        rows.push_back(Row{size_t(row->start - base), size_t(row->end - base), row->width});
+    }
+    nvgTextMetrics(vg, &ascent, nullptr, &line_height);
+}
+
 void draw_text_box (
     NVGcontext *vg,
     float x, float y, float w, float h,
     float left_margin, float right_margin,
     float top_margin, float bottom_margin,
-    std::string text,
+    const std::string& text,
     std::shared_ptr<rack::window::Font> font,
     float font_size,
     PackedColor text_color,
     HAlign halign,
     VAlign valign,
     PackedColor margin_color,
-    float first_baseline
+    float first_baseline,
+    TextLayout* layout
 ) {
     // DEBUG
     // auto co_debug = nvgHSLAf(30.f/360.f, .8f, .8f, .35f);
@@ -144,47 +163,51 @@ void draw_text_box (
 
     }
 
-    NVGtextRow text_rows[50];
     //nvgSave(vg);
     SetTextStyle(vg, font, fromPacked(text_color), font_size);
 
     float width = (HAlign::Center == halign) ? w : w - (left_margin + right_margin);
     float height = (VAlign::Middle == valign) ? h : h - (top_margin + bottom_margin);
-    int nrows = nvgTextBreakLines(vg, text.c_str(), nullptr, width, text_rows, 50);
-    float tm_ascent;
-    float tm_height;
-	nvgTextMetrics(vg, &tm_ascent, nullptr, &tm_height);
-    float total_height = nrows * tm_height;
+
+    // uncached callers share a scratch layout (UI thread only), which keeps its allocations
+    static TextLayout scratch;
+    if (!layout) {
+        layout = &scratch;
+        layout->invalidate();
+    }
+    if (!layout->valid_for(text, font->handle, font_size, width)) {
+        layout->measure(vg, text, font->handle, font_size, width);
+    }
+    const char * base = layout->text.c_str();
+    float tm_height = layout->line_height;
+    float total_height = layout->rows.size() * tm_height;
     float ty{0};
     switch (valign) {
         case VAlign::Top: ty = y + top_margin; break;
         case VAlign::Middle: ty = y + top_margin + height*.5 - total_height*.5; break;
         case VAlign::Bottom: ty = h - bottom_margin - total_height; break;
-        case VAlign::Baseline: ty = y + top_margin - (std::isfinite(first_baseline) ? first_baseline : tm_ascent); break;
+        case VAlign::Baseline: ty = y + top_margin - (std::isfinite(first_baseline) ? first_baseline : layout->ascent); break;
     }
     nvgTextAlign(vg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
     float tx{0};
     switch (halign) {
     case HAlign::Left: {
         tx = x + left_margin;
-        NVGtextRow* row = text_rows;
-        for (int n = 0; n < nrows; n++, row++) {
-            nvgText(vg, tx, ty, row->start, row->end);
+        for (auto& row: layout->rows) {
+            nvgText(vg, tx, ty, base + row.start, base + row.end);
             ty += tm_height;
         }
     } break;
     case HAlign::Center: {
-        NVGtextRow* row = text_rows;
-        for (int n = 0; n < nrows; n++, row++) {
-            nvgText(vg, x + w*.5f - row->width *.5f, ty, row->start, row->end);
+        for (auto& row: layout->rows) {
+            nvgText(vg, x + w*.5f - row.width *.5f, ty, base + row.start, base + row.end);
             ty += tm_height;
         }
     } break;
     case HAlign::Right: {
         tx = x + w - right_margin;
-        NVGtextRow* row = text_rows;
-        for (int n = 0; n < nrows; n++, row++) {
-            nvgText(vg, tx - row->width, ty, row->start, row->end);
+        for (auto& row: layout->rows) {
+            nvgText(vg, tx - row.width, ty, base + row.start, base + row.end);
             ty += tm_height;
         }
     } break;
@@ -207,7 +230,8 @@ void draw_oriented_text_box(
     VAlign valign,
     Orientation orientation,
     PackedColor margin_color,
-    float first_baseline
+    float first_baseline,
+    TextLayout* layout
 ) {
     float x = box.pos.x;
     float y = box.pos.y;
@@ -225,7 +249,7 @@ void draw_oriented_text_box(
             left_margin, right_margin,
             top_margin, bottom_margin,
             text, font, font_size, text_color, halign, valign,
-            margin_color, first_baseline);
+            margin_color, first_baseline, layout);
         break;
 
     case Orientation::Down:
@@ -237,7 +261,7 @@ void draw_oriented_text_box(
             left_margin, right_margin,
             top_margin, bottom_margin,
             text, font, font_size, text_color, halign, valign,
-            margin_color, first_baseline);
+            margin_color, first_baseline, layout);
         nvgRestore(vg);
         break;
 
@@ -250,7 +274,7 @@ void draw_oriented_text_box(
             left_margin, right_margin,
             top_margin, bottom_margin,
             text, font, font_size, text_color, halign, valign,
-            margin_color, first_baseline);
+            margin_color, first_baseline, layout);
         nvgRestore(vg);
         break;
 
@@ -263,7 +287,7 @@ void draw_oriented_text_box(
             left_margin, right_margin,
             top_margin, bottom_margin,
             text, font, font_size, text_color, halign, valign,
-            margin_color, first_baseline);
+            margin_color, first_baseline, layout);
         nvgRestore(vg);
         break;
     }
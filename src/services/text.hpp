@@ -29,19 +29,50 @@ void CenterText(NVGcontext *vg, float x, float y, const char * text, const char
 // Text style must have been previously set.
 void RightAlignText(NVGcontext *vg, float x, float y, const char * text, const char * end);
 
+// Line breaks and metrics of text laid out in a box.
+// A widget that draws the same text repeatedly keeps one and passes it to draw_text_box,
+// so the text is only measured again when the text, font, size or width change.
+struct TextLayout
+{
+    struct Row {
+        size_t start;
+        size_t end;
+        float width;
+    };
+    std::string text;
+    int font_handle{-1};
+    float font_size{0.f};
+    float width{0.f};
+    float ascent{0.f};
+    float line_height{0.f};
+    std::vector<Row> rows;
+
+    void invalidate() { font_handle = -1; }
+    bool valid_for(const std::string& str, int font, float size, float box_width) const {
+        return (font_handle >= 0)
+            && (font == font_handle)
+            && (size == font_size)
+            && (box_width == width)
+            && (str == text);
+    }
+    // Text style must have been previously set
+    void measure(NVGcontext *vg, const std::string& str, int font, float size, float box_width);
+};
+
 void draw_text_box (
     NVGcontext *vg,
     float x, float y, float w, float h,
     float left_margin, float right_margin,
     float top_margin, float bottom_margin,
-    std::string text,
+    const std::string& text,
     std::shared_ptr<rack::window::Font> font,
     float font_size,
     PackedColor text_color,
     HAlign halign,
     VAlign valign,
     PackedColor margin_color = colors::NoColor,
-    float first_baseline = INFINITY
+    float first_baseline = INFINITY,
+    TextLayout* layout = nullptr
 );
 
 void draw_oriented_text_box(
@@ -57,7 +88,8 @@ void draw_oriented_text_box(
     VAlign valign,
     Orientation orientation,
     PackedColor margin_color = colors::NoColor,
-    float first_baseline = INFINITY
+    float first_baseline = INFINITY,
+    TextLayout* layout = nullptr
 );
 
 } // namespace pachde
@@ -69,9 +69,8 @@ OptionMenuEntry* make_theme_item(ModuleWidget* source, IThemeHolder* it, const s
 void add_theme_items(rack::ui::Menu *menu, ModuleWidget* source, IThemeHolder* it) {
     menu->addChild(make_theme_item(source, it, "Follow Rack UI theme", theme_name::Ui));
     menu->addChild(make_theme_item(source, it, "Follow Rack prefer dark panels", theme_name::PreferDark));
-    auto themes = getThemeCache();
-    for (auto theme: themes.themes) {
-        menu->addChild(make_theme_item(source, it, theme->name, theme->name));
+    for (const auto& name: getThemeNames()) {
+        menu->addChild(make_theme_item(source, it, name, name));
     }
 }
 
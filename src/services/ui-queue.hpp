@@ -0,0 +1,39 @@
+// Copyright (C) Paul Chase Dempsey
+#pragma once
+#include <rack.hpp>
+#include <atomic>
+
+namespace pachde {
+
+// Lock-free, single-producer/single-consumer queue of intents from a module
+// (engine thread) to its widget (UI thread).
+// process() posts small POD commands, and the widget applies them in step(),
+// so the engine never touches widgets or allocates for the UI.
+// When the UI falls behind (or isn't there), new intents are dropped and counted.
+template <typename T, size_t N = 16>
+struct UiQueue
+{
+    rack::dsp::RingBuffer<T, N> ring;
+    std::atomic<uint32_t> dropped{0};
+
+    bool empty() { return ring.empty(); }
+
+    // producer (engine thread)
+    bool post(const T& item) {
+        if (ring.full()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        ring.push(item);
+        return true;
+    }
+
+    // consumer (UI thread)
+    bool next(T& item) {
+        if (ring.empty()) return false;
+        item = ring.shift();
+        return true;
+    }
+};
+
+}
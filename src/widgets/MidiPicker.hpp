@@ -82,7 +82,9 @@ struct BasicMidiPicker : TipWidget
         menu->addChild(new MenuSeparator);
 
         auto current_claim = device->get_claim();
-        auto connections = EnumerateMidiConnections(false);
+        auto snapshot = broker->devices();
+        if (!snapshot) return;
+        auto connections = snapshot->connections;
         for (auto it = connections.cbegin(); it != connections.cend(); ++it) {
             auto conn = *it;
             auto item_claim = conn->info.claim();
@@ -159,7 +161,9 @@ struct CoreMidiPicker : TipWidget
 
         auto current_claim = setter->get_claim();
 
-        auto connections = EnumerateMidiConnections(false);
+        auto snapshot = broker->devices();
+        if (!snapshot) return;
+        auto connections = snapshot->connections;
         if (is_em()) {
             for (auto it = connections.cbegin(); it != connections.cend(); ++it) {
                 auto conn = *it;
@@ -0,0 +1,103 @@
+#pragma once
+#include <rack.hpp>
+using namespace ::rack;
+
+namespace pachde {
+
+inline uint64_t hash_mix(uint64_t hash, uint64_t value)
+{
+    return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
+// A widget drawn in a CachedLayer summarizes everything it draws in a signature:
+// content, states, hover. When the signature changes, the layer is redrawn.
+struct ICachedDraw
+{
+    virtual uint64_t draw_signature() = 0;
+};
+
+// Framebuffer for a group of mostly static widgets, such as a grid of preset names.
+// The widgets are drawn into the framebuffer once, and redrawn only when
+// one of their signatures changes, or on a DirtyEvent (theme change).
+// Events pass through to the widgets as usual.
+struct CachedLayer : FramebufferWidget
+{
+    using Base = FramebufferWidget;
+    std::vector<ICachedDraw*> cached;
+    uint64_t signature{0};
+    // The framebuffer is sized to the children rather than the layer's box,
+    // so an empty child spanning the box holds the margin set by fit().
+    Widget* extent{nullptr};
+    // When it has a size, drawing is clipped to this rect (in the parent's coordinates),
+    // for widgets that scroll past the edges of a list.
+    math::Rect clip;
+
+    template <typename TWidget>
+    TWidget* add(TWidget* widget) {
+        cached.push_back(widget);
+        addChild(widget);
+        return widget;
+    }
+
+    // Size the layer to the widgets (added in the parent's coordinates) plus a margin
+    // for anything drawn outside their boxes, and move them into the layer's coordinates.
+    // Call once, after adding the widgets.
+    void fit(float margin) { fit(Vec(margin, margin)); }
+    void fit(Vec margin)
+    {
+        if (children.empty() || extent) return;
+        math::Rect bounds = children.front()->box;
+        for (Widget* child: children) {
+            bounds = bounds.expand(child->box);
+        }
+        box = bounds.grow(margin);
+        for (Widget* child: children) {
+            child->box.pos = child->box.pos.minus(box.pos);
+        }
+        // draws nothing and takes no events
+        extent = new Widget;
+        extent->box = box.zeroPos();
+        addChildBottom(extent);
+        setDirty();
+    }
+
+    void set_clip(math::Rect rect) { clip = rect; }
+
+    void scissor(const DrawArgs& args)
+    {
+        if (clip.size.isZero()) return;
+        nvgIntersectScissor(args.vg, clip.pos.x - box.pos.x, clip.pos.y - box.pos.y, clip.size.x, clip.size.y);
+    }
+
+    void draw(const DrawArgs& args) override
+    {
+        nvgSave(args.vg);
+        scissor(args);
+        Base::draw(args);
+        nvgRestore(args.vg);
+    }
+
+    // layers are drawn straight from the widgets, not the framebuffer
+    void drawLayer(const DrawArgs& args, int layer) override
+    {
+        nvgSave(args.vg);
+        scissor(args);
+        Base::drawLayer(args, layer);
+        nvgRestore(args.vg);
+    }
+
+    void step() override
+    {
+        uint64_t current = 0;
+        for (auto item: cached) {
+            current = hash_mix(current, item->draw_signature());
+        }
+        if (current != signature) {
+            signature = current;
+            setDirty();
+        }
+        Base::step();
+    }
+};
+
+}
@@ -37,28 +37,57 @@ void AlphaWidget::onButton(const ButtonEvent& e) {
     e.consume(this);
 }
 
-void drawCheckers(const rack::widget::Widget::DrawArgs& args, float x, float y, float width, float height) {
-    auto vg = args.vg;
+// A 2x2 checker image: with nearest filtering, an image pattern scales it
+// to any cell size. One per NanoVG context (the window and framebuffers differ).
+static int checkerImage(NVGcontext* vg)
+{
+    struct CheckerImage { NVGcontext* vg; int handle; };
+    static std::vector<CheckerImage> images;
+    for (auto& image: images) {
+        if (image.vg == vg) return image.handle;
+    }
+    const unsigned char g = 128;
+    const unsigned char pixels[16] = {
+        g, g, g, 255,   0, 0, 0, 0,
+        0, 0, 0, 0,     g, g, g, 255
+    };
+    int handle = nvgCreateImageRGBA(vg, 2, 2, NVG_IMAGE_REPEATX | NVG_IMAGE_REPEATY | NVG_IMAGE_NEAREST, pixels);
+    if (handle) {
+        images.push_back(CheckerImage{vg, handle});
+    }
+    return handle;
+}
 
+void drawCheckers(NVGcontext* vg, float x, float y, float width, float height) {
     float dx = 5.f;
     float m = std::min(width, height);
     if (m < 15.f) {
         dx = m / 3.f;
     }
+    int image = checkerImage(vg);
+    if (!image) return;
 
-    nvgScissor(vg, x, y, width, height);
     nvgBeginPath(vg);
-    int r = 0;
-    for (float iy = y; iy < y + height; iy += dx, r++) {
-        bool g = (0 == (r & 1));
-        for (float ix = x; ix < x + width; ix += dx) {
-            if (g) nvgRect(vg, ix, iy, dx, dx);
-            g = !g;
-        }
-    }
-    nvgFillColor(vg, co_gray);
+    nvgRect(vg, x, y, width, height);
+    nvgFillPaint(vg, nvgImagePattern(vg, x, y, 2.f * dx, 2.f * dx, 0.f, image, 1.f));
     nvgFill(vg);
-    nvgResetScissor(vg);
+}
+
+void drawCheckers(const rack::widget::Widget::DrawArgs& args, float x, float y, float width, float height) {
+    drawCheckers(args.vg, x, y, width, height);
+}
+
+void drawSwatch(NVGcontext* vg, float x, float y, float width, float height, PackedColor color) {
+    if (isOpaque(color)) {
+        FillRect(vg, x, y, width, height, fromPacked(color));
+        return;
+    }
+    FillRect(vg, x, y, width*.5f, height, co_white);
+    FillRect(vg, x + width*.5f, y, width*.5f, height, co_black);
+    drawCheckers(vg, x, y, width, height);
+    if (color) {
+        FillRect(vg, x, y, width, height, fromPacked(color));
+    }
 }
 
 void AlphaWidget::draw(const DrawArgs& args) {
@@ -200,8 +229,8 @@ SLWidget::~SLWidget() {
 void SLWidget::setHue(float new_hue) {
     if (new_hue == hue) return;
     hue = new_hue;
-    SetSLSpectrum(getRamp()->getPic(), hue);
-    getRamp()->invalidateImage();
+    // regenerated once per frame in draw, however many hue changes arrive while dragging
+    spectrum_stale = true;
 }
 cachePic* SLWidget::getRamp() {
     if (nullptr == ramp) {
@@ -258,6 +287,11 @@ void SLWidget::onButton(const ButtonEvent& e) {
 
 void SLWidget::draw(const DrawArgs& args) {
     auto vg = args.vg;
+    if (spectrum_stale) {
+        spectrum_stale = false;
+        SetSLSpectrum(getRamp()->getPic(), hue);
+        getRamp()->refreshImage();
+    }
     auto image_handle = getRamp()->getHandle(vg);
     if (image_handle) {
         nvgBeginPath(vg);
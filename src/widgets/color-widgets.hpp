@@ -6,17 +6,15 @@ using namespace ::rack;
 using namespace pachde;
 
 namespace widgetry {
+void drawCheckers(NVGcontext* vg, float x, float y, float width, float height);
 void drawCheckers(const rack::widget::Widget::DrawArgs& args, float x, float y, float width, float height);
+// A color over half white, half black and a checkerboard, so its transparency shows.
+void drawSwatch(NVGcontext* vg, float x, float y, float width, float height, PackedColor color);
 
 struct Swatch: Widget {
     PackedColor color{0};
     void draw(const DrawArgs& args) override {
-        FillRect(args.vg, 0.f, 0.f, box.size.x*.5f, box.size.y, nvgRGB(255,255,255));
-        FillRect(args.vg, box.size.x*.5f, 0.f, box.size.x*.5f, box.size.y, nvgRGB(0,0,0));
-        drawCheckers(args, 0.f, 0.f, box.size.x, box.size.y);
-        if (color) {
-            FillRect(args.vg, 0.f, 0.f, box.size.x, box.size.y, fromPacked(color));
-        }
+        drawSwatch(args.vg, 0.f, 0.f, box.size.x, box.size.y, color);
     }
 };
 
@@ -77,6 +75,7 @@ struct SLWidget : OpaqueWidget
     float sat = .5f;
     float light = .5f;
     cachePic* ramp = nullptr;
+    bool spectrum_stale = false;
     std::function<void(float, float)> clickHandler;
     Vec drag_pos;
 
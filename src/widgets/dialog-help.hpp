@@ -33,7 +33,7 @@ struct DialogStyles {
 };
 
 template <typename TParent>
-void add_close_button(TParent* host, ::svg_query::BoundsIndex bounds, const char* key, std::shared_ptr<SvgTheme> svg_theme) {
+void add_close_button(TParent* host, const ::svg_query::BoundsIndex& bounds, const char* key, std::shared_ptr<SvgTheme> svg_theme) {
     auto close = createWidgetCentered<CloseButton>(bounds[key].getCenter());
     close->set_handler([=](){ host->close(); } );
     close->applyTheme(svg_theme);
@@ -41,12 +41,12 @@ void add_close_button(TParent* host, ::svg_query::BoundsIndex bounds, const char
 }
 
 template <typename TParent, typename TKnob = RoundBlackKnob>
-void add_knob(TParent* host, ::svg_query::BoundsIndex &bounds, const char *key, Module* module, int param) {
+void add_knob(TParent* host, const ::svg_query::BoundsIndex& bounds, const char *key, Module* module, int param) {
     host->addChild(createParamCentered<TKnob>(bounds[key].getCenter(), module, param));
 }
 
 template <typename TParent>
-void add_check(TParent* host, ::svg_query::BoundsIndex &bounds, const char *key,
+void add_check(TParent* host, const ::svg_query::BoundsIndex& bounds, const char *key,
     Module* module, int param, std::shared_ptr<svg_theme::SvgTheme> svg_theme = nullptr
 ) {
     auto check = Center(createThemedParamButton<CheckButton>(
@@ -64,7 +64,7 @@ void add_check(TParent* host, ::svg_query::BoundsIndex &bounds, const char *key,
 template <typename TParent>
 TextLabel* add_label(
     TParent* host,
-    ::svg_query::BoundsIndex &bounds,
+    const ::svg_query::BoundsIndex& bounds,
     const char *key,
     const char *text,
     LabelStyle* style,
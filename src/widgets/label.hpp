@@ -62,6 +62,7 @@ struct TextLabel : TransparentWidget, svg_theme::IThemed
     std::string text;
     bool own_format{false};
     bool bright{false};
+    TextLayout layout;
 
     TextLabel() {}
     TextLabel(LabelStyle* s) : format(s) {}
@@ -97,6 +98,7 @@ struct TextLabel : TransparentWidget, svg_theme::IThemed
 
     void applyTheme(std::shared_ptr<svg_theme::SvgTheme> theme) override {
         if (format) format->applyTheme(theme);
+        layout.invalidate();
     }
 
     void draw_text(const DrawArgs& args) {
@@ -107,13 +109,14 @@ struct TextLabel : TransparentWidget, svg_theme::IThemed
                 args.vg, box.zeroPos(), 0.f, 0.f, 0.f, 0.f,
                 text, font, format->text_height, format->color,
                 format->halign, format->valign, format->orientation,
-                format->baseline
+                colors::NoColor, format->baseline, &layout
             );
         } else {
             draw_oriented_text_box(
                 args.vg, box.zeroPos(), 0.f, 0.f, 0.f, 0.f,
                 text, font, 12.f, colors::G50,
-                HAlign::Center, VAlign::Baseline, Orientation::Normal
+                HAlign::Center, VAlign::Baseline, Orientation::Normal,
+                colors::NoColor, INFINITY, &layout
             );
         }
     }
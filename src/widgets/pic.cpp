@@ -2,10 +2,23 @@
 #include "stb_image.h"
 #include "pic.hpp"
 #include "services/colors.hpp"
+#include "services/perf-counters.hpp"
 
 using namespace ::rack;
 namespace widgetry {
 
+// Spectrum generation timing, in the performance counters
+pachde::PerfTimer perf_hsl_spectrum;
+pachde::PerfTimer perf_hue_ramp;
+pachde::PerfTimer perf_sl_spectrum;
+struct PicPerf : pachde::PerfGroup {
+    PicPerf() : PerfGroup(nullptr, "Color picker") {
+        add("hsl-spectrum", &perf_hsl_spectrum);
+        add("hue-ramp", &perf_hue_ramp);
+        add("sl-spectrum", &perf_sl_spectrum);
+    }
+} pic_perf;
+
 Pic* Pic::CreateRaw(int width, int height) {
     auto p = new Pic();
     p->_width = width;
@@ -241,25 +254,69 @@ void Pic::close()
     _reason = "";
 }
 
+// Vectorized nvgHSL, four pixels at a time.
+static simd::float_4 hue_channel(simd::float_4 h, simd::float_4 m1, simd::float_4 m2)
+{
+    h = simd::ifelse(h < 0.f, h + 1.f, h);
+    h = simd::ifelse(h > 1.f, h - 1.f, h);
+    simd::float_4 rise = m1 + (m2 - m1) * h * 6.f;
+    simd::float_4 fall = m1 + (m2 - m1) * (2.f/3.f - h) * 6.f;
+    simd::float_4 v = simd::ifelse(h < 4.f/6.f, fall, m1);
+    v = simd::ifelse(h < 3.f/6.f, m2, v);
+    v = simd::ifelse(h < 1.f/6.f, rise, v);
+    return simd::clamp(v);
+}
+
+static void hsl_rgba_4(simd::float_4 h, simd::float_4 s, simd::float_4 l, unsigned char* data)
+{
+    h = h - simd::floor(h);
+    s = simd::clamp(s);
+    l = simd::clamp(l);
+    simd::float_4 m2 = simd::ifelse(l <= .5f, l * (1.f + s), l + s - l * s);
+    simd::float_4 m1 = 2.f * l - m2;
+    simd::float_4 r = hue_channel(h + 1.f/3.f, m1, m2) * 255.f;
+    simd::float_4 g = hue_channel(h, m1, m2) * 255.f;
+    simd::float_4 b = hue_channel(h - 1.f/3.f, m1, m2) * 255.f;
+    for (int i = 0; i < 4; ++i) {
+        *data++ = static_cast<unsigned char>(r[i]);
+        *data++ = static_cast<unsigned char>(g[i]);
+        *data++ = static_cast<unsigned char>(b[i]);
+        *data++ = 255;
+    }
+}
+
+// Fill a row of RGBA pixels whose hue, saturation and lightness
+// each step linearly from the first pixel.
+static void hsl_row(unsigned char* data, int count, float h, float dh, float s, float ds, float l, float dl)
+{
+    const simd::float_4 lanes{0.f, 1.f, 2.f, 3.f};
+    int x = 0;
+    for (; x + 4 <= count; x += 4, data += 16) {
+        simd::float_4 xs = lanes + static_cast<float>(x);
+        hsl_rgba_4(h + dh * xs, s + ds * xs, l + dl * xs, data);
+    }
+    for (; x < count; ++x) {
+        auto pix = nvgHSL(h + dh * x, s + ds * x, l + dl * x);
+        *data++ = static_cast<unsigned char>(pix.r * 255.f);
+        *data++ = static_cast<unsigned char>(pix.g * 255.f);
+        *data++ = static_cast<unsigned char>(pix.b * 255.f);
+        *data++ = 255;
+    }
+}
+
 Pic * CreateHSLSpectrum(float saturation)
 {
+    pachde::PerfScope perf(perf_hsl_spectrum);
     auto p = Pic::CreateRaw(256, 256);
-    unsigned char* data = p->_data;
     for (int y = 0; y < 256; ++y) {
-        auto L = static_cast<float>(y)/255.f;
-        for (int x = 0; x < 256; ++x) {
-            auto pix = nvgHSL(static_cast<float>(x)/255.f, saturation, L);
-            *data++ = static_cast<unsigned char>(pix.r * 255.f);
-            *data++ = static_cast<unsigned char>(pix.g * 255.f);
-            *data++ = static_cast<unsigned char>(pix.b * 255.f);
-            *data++ = static_cast<unsigned char>(255);
-        }
+        hsl_row(p->pixel_address(0, y), 256, 0.f, 1.f/255.f, saturation, 0.f, static_cast<float>(y)/255.f, 0.f);
     }
     return p;
 }
 
 Pic * CreateHueRamp(int width, int height, bool vertical)
 {
+    pachde::PerfScope perf(perf_hue_ramp);
     auto p = Pic::CreateRaw(width, height);
     unsigned char* data = p->_data;
     if (vertical) {
@@ -274,19 +331,11 @@ Pic * CreateHueRamp(int width, int height, bool vertical)
             }
         }
     } else {
-        auto wf = static_cast<float>(width);
-        for (float x = 0.f; x < wf; ++x) {
-            auto color = nvgHSL(x/wf, 1.0f, 0.8f);
-            auto row = data;
-            for (int y = 0; y < height; ++y, row += p->stride()) {
-                auto pixel = row;
-                *pixel++ = static_cast<unsigned char>(color.r * 255.f);
-                *pixel++ = static_cast<unsigned char>(color.g * 255.f);
-                *pixel++ = static_cast<unsigned char>(color.b * 255.f);
-                *pixel++ = 255;
-            }
+        // every row is the same
+        hsl_row(data, width, 0.f, 1.f/width, 1.f, 0.f, .8f, 0.f);
+        for (int y = 1; y < height; ++y) {
+            std::memcpy(p->pixel_address(0, y), data, p->stride());
         }
-
     }
     return p;
 }
@@ -294,19 +343,13 @@ Pic * CreateHueRamp(int width, int height, bool vertical)
 // init a saturation-lightness spectrum
 // for a given hue on a 256x256 image
 void SetSLSpectrum(Pic* pic, float hue) {
-    unsigned char* data = pic->_data;
+    pachde::PerfScope perf(perf_sl_spectrum);
     auto h = pic->height();
     float hf = h;
     auto w = pic->width();
     float wf = w;
     for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            auto pix = nvgHSL(hue, x/wf, (hf-y)/hf);
-            *data++ = static_cast<unsigned char>(pix.r * 255.f);
-            *data++ = static_cast<unsigned char>(pix.g * 255.f);
-            *data++ = static_cast<unsigned char>(pix.b * 255.f);
-            *data++ = 255;
-        }
+        hsl_row(pic->pixel_address(0, y), w, hue, 0.f, 0.f, 1.f/wf, (hf-y)/hf, 0.f);
     }
 }
 
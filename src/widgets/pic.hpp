@@ -51,6 +51,7 @@ struct cachePic
     Pic* pic = nullptr;
     int image_handle = 0; // nvg Image handle
     intptr_t image_cookie = 0; // cookie for image data
+    bool image_stale = false; // pixels changed in place
 
     ~cachePic() {
         //HACK grab a VG context from anywhere and hope its the right one
@@ -139,6 +140,12 @@ struct cachePic
         image_cookie = 0;
     }
 
+    // The pic's pixels were rewritten in place (same size and buffer):
+    // the nvg image is updated rather than recreated.
+    void refreshImage() {
+        image_stale = true;
+    }
+
     void clearImageCache(NVGcontext* vg) {
         if (image_handle) {
             nvgDeleteImage(vg, image_handle);
@@ -156,6 +163,10 @@ struct cachePic
         if (!image_cookie && !image_handle) {
             image_handle = nvgCreateImageRGBA(vg, pic->width(),  pic->height(), 0, pic->data());
             image_cookie = reinterpret_cast<intptr_t>(pic->data());
+            image_stale = false;
+        } else if (image_stale && image_handle && (image_cookie == reinterpret_cast<intptr_t>(pic->data()))) {
+            nvgUpdateImage(vg, image_handle, pic->data());
+            image_stale = false;
         } else {
             auto new_image_cookie = reinterpret_cast<intptr_t>(pic->data());
             if (new_image_cookie != image_cookie) {
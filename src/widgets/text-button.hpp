@@ -13,6 +13,7 @@ struct TextButton : FrameButton
     PackedColor color = 0xffe8e8e8;
     PackedColor bg = 0xff181818;
     LabelStyle label_style{"ctl-glyph", HAlign::Center, VAlign::Middle, 12.f, true};
+    TextLayout layout;
 
     void set_text(std::string t) { text = t; }
     void set_style(LabelStyle style) { label_style = style; }
@@ -24,6 +25,7 @@ struct TextButton : FrameButton
             color = GetPackedStockColor(StockColor::Gray_65p);
         }
         theme->getFillColor(bg, "tbtn-face", true);
+        layout.invalidate();
     }
 
     void draw(const DrawArgs& args) override
@@ -44,7 +46,8 @@ struct TextButton : FrameButton
         draw_oriented_text_box(vg,
             draw_box, 0.f, 0.f, 0.f, 0.f,
             text, font, label_style.text_height, color,
-            label_style.halign, label_style.valign, label_style.orientation
+            label_style.halign, label_style.valign, label_style.orientation,
+            colors::NoColor, INFINITY, &layout
         );
 
         nvgResetScissor(vg);
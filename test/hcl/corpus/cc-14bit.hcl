@@ -0,0 +1 @@
+"expect b0.56.40 b0.01.3e" cc 1 8000
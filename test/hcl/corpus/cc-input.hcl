@@ -0,0 +1 @@
+"expect b0.56.00 b0.14.00" cc 20 input
@@ -0,0 +1 @@
+"expect b0.56.00 b0.0c.40 b0.56.00 b0.07.64" cc 12 '64 cc 7 100
@@ -0,0 +1 @@
+"expect error" ch 17 cc 1 2
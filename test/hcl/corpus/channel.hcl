@@ -0,0 +1 @@
+"expect bf.14.05" ch 16 cc 20 5
@@ -0,0 +1 @@
+"expect bf.38.15 af.01.02 bf.38.16 af.03.04" gp [1 2] gp1 [3 4]
@@ -0,0 +1 @@
+"expect error" cc 1 2  cc 3 4
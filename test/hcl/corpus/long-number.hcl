@@ -0,0 +1 @@
+"expect error" cc 1 99999999999999999999
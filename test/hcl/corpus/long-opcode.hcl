@@ -0,0 +1 @@
+"expect error" mmmmmmmmmmmm
@@ -0,0 +1 @@
+"expect b0.56.00 b0.28.00" m 7 input
@@ -0,0 +1 @@
+"expect b0.0c.00 b0.11.00 b0.56.00 b0.28.00 b0.56.00 b0.3f.00 b0.56.00 b0.66.00 b0.56.00 b0.77.00 b0.61.00 b0.28.00 b0.61.00 b0.3f.00 b0.61.00 b0.66.00 b0.61.00 b0.77.00" m 1 0 m 6 0 m 7 0 m 30 0 m 31 0 m 48 0 m 49 0 m 72 0 m 73 0 m 90 0
@@ -0,0 +1 @@
+"expect b0.0c.60 b0.56.00 b0.28.00 b0.61.00 b0.77.40" m 1 .5 m 7 -1 m 90 zero
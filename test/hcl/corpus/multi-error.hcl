@@ -0,0 +1 @@
+"expect error" cc 200 5 mp [1 x 3] m 99 2 cc 1 2 kp [1
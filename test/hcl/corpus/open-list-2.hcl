@@ -0,0 +1 @@
+"expect error" kp [1
@@ -0,0 +1 @@
+"expect none" {
@@ -0,0 +1 @@
+"expect c0.03.00" "patch" pc 3
@@ -0,0 +1 @@
+"expect bf.38.14 af.00.04" mp [input 4]
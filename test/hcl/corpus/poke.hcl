@@ -0,0 +1 @@
+"expect bf.38.14 af.01.02 af.03.04 bf.38.13 af.05.06" mp [1 2] mp [3 4] fp [5 6]
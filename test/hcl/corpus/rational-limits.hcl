@@ -0,0 +1 @@
+"expect b0.56.00 b0.01.7f b0.56.00 b0.29.7f b0.56.00 b0.2a.00" cc 1 .9999999999999999999 m 8 .99999 m 9 -.99999
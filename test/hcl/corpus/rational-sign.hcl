@@ -0,0 +1 @@
+"expect b0.56.00 b0.2a.20 b0.56.00 b0.2a.60 b0.56.00 b0.2a.60 b0.56.00 b0.2a.30" m 9 -.5 m 9 .5 m 9 +.5 m 9 -,25
@@ -0,0 +1 @@
+"expect bf.38.05 af.01.02" s5 [1 2]
@@ -0,0 +1 @@
+"expect bf.38.05 af.01.02 af.03.00" s 5 [1 2 3]
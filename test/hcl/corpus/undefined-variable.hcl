@@ -0,0 +1 @@
+"expect error" mp [x 1]
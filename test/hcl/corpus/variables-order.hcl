@@ -0,0 +1 @@
+"expect bf.38.14 af.03.05" {b=5; a=3} mp [a b]
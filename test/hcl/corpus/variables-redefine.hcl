@@ -0,0 +1 @@
+"expect bf.38.14 af.09.04" {a=3; b=4; a=9} mp [a b]
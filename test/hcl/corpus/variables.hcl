@@ -0,0 +1 @@
+"expect bf.38.14 af.03.64" {a=3; b=100} mp [a b]
@@ -0,0 +1,47 @@
+// HCL compile-time benchmark.
+// Builds against the current compiler, or the one before the table-driven lexer (make bench-baseline).
+#include "hcl.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace pachde {
+
+std::string format_string(const char *fmt, ...)
+{
+    char buffer[512];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return buffer;
+}
+
+}
+using namespace pachde;
+
+int main(int argc, char** argv)
+{
+    int repeat = argc > 1 ? atoi(argv[1]) : 10000;
+
+    // about 1 KB in 20 statement groups, with comments, variables, pokes, macros, and cc
+    std::string program = "\"big pad\" {a=1; b=2; c=3; d=4; e=5} ";
+    for (int i = 0; i < 20; ++i) {
+        program += "mp [a b c d 1 2] m 12 .25 cc 11 '100 ch 2 kp [e 3] ";
+    }
+
+    std::vector<PackedMidiMessage> midi;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) {
+        HclCompiler hc;
+        midi.clear();
+        if (!hc.compile(program, &midi)) {
+            printf("compile failed: %s\n", hc.error_message.c_str());
+            return 1;
+        }
+    }
+    auto finish = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(finish - start).count() / repeat;
+    printf("%.2f us/compile (%d chars, %d messages, %d runs)\n", us, int(program.size()), int(midi.size()), repeat);
+    return 0;
+}
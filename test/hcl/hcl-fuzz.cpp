@@ -0,0 +1,195 @@
+// HCL compiler regression and fuzz harness.
+// Compiles each corpus program and checks it against the expectation in its leading comment,
+// then compiles random and mutated programs, checking that the compiler's results stay consistent.
+#include "hcl.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace pachde {
+
+std::string format_string(const char *fmt, ...)
+{
+    char buffer[512];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return buffer;
+}
+
+}
+using namespace pachde;
+
+static std::string format_midi(const std::vector<PackedMidiMessage>& midi)
+{
+    std::string result;
+    char item[16];
+    for (auto m: midi) {
+        if (!result.empty()) result.push_back(' ');
+        snprintf(item, sizeof(item), "%02x.%02x.%02x", m.bytes.status_byte, m.bytes.data1, m.bytes.data2);
+        result.append(item);
+    }
+    return result;
+}
+
+static bool read_file(const char* path, std::string& text)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    text = buffer.str();
+    while (!text.empty() && ('\n' == text.back() || '\r' == text.back())) {
+        text.pop_back();
+    }
+    return true;
+}
+
+// Consistency checks that hold for any program, valid or not.
+// Returns an empty string when the result is consistent.
+static std::string check_invariants(const std::string& program, HclCompiler& hc, const std::vector<PackedMidiMessage>& midi, const std::vector<HclParam>& params)
+{
+    if (hc.ok != hc.errors.empty()) return "ok disagrees with the error list";
+    if (hc.errors.size() > HclCompiler::MAX_ERRORS) return "too many errors";
+    if (!hc.ok) {
+        if (hc.errors.front().pos != hc.error_pos) return "error_pos is not the first error";
+        if (hc.errors.front().message != hc.error_message) return "error_message is not the first error";
+    }
+    for (auto& e: hc.errors) {
+        if (e.pos < 0 || size_t(e.pos) > program.size()) return format_string("error position %d outside the program", e.pos);
+        if (e.message.empty()) return "error without a message";
+    }
+    for (auto p: params) {
+        size_t last = p.index + (HclParam::Kind::Pair14 == p.kind ? 1 : 0);
+        if (last >= midi.size()) return format_string("input parameter %d past the %d messages", int(p.index), int(midi.size()));
+    }
+    for (auto m: midi) {
+        if (!(m.bytes.status_byte & 0x80)) return "message without a status byte";
+        if ((m.bytes.data1 | m.bytes.data2) & 0x80) return "data byte over 7 bits";
+    }
+    return "";
+}
+
+// The leading comment of a corpus program states the expected result:
+//   "expect b0.0c.40 b0.0d.05 ..."   compiles to exactly these messages
+//   "expect none"                    compiles to no messages
+//   "expect error"                   fails to compile
+static bool check_corpus_program(const char* path, bool print)
+{
+    std::string program;
+    if (!read_file(path, program)) {
+        printf("FAIL %s: can't read\n", path);
+        return false;
+    }
+    HclCompiler hc;
+    std::vector<PackedMidiMessage> midi;
+    std::vector<HclParam> params;
+    hc.compile(program, &midi, &params);
+    auto actual = !hc.ok ? std::string("error") : midi.empty() ? std::string("none") : format_midi(midi);
+    if (print) {
+        printf("%s: %s\n", path, actual.c_str());
+        for (auto& e: hc.errors) printf("    %d: %s\n", e.pos, e.message.c_str());
+        return true;
+    }
+
+    auto problem = check_invariants(program, hc, midi, params);
+    if (!problem.empty()) {
+        printf("FAIL %s: %s\n", path, problem.c_str());
+        return false;
+    }
+    const char prefix[] = "\"expect ";
+    if (0 != program.compare(0, sizeof(prefix) - 1, prefix)) {
+        printf("FAIL %s: no leading \"expect ...\" comment\n", path);
+        return false;
+    }
+    auto end = program.find('"', sizeof(prefix) - 1);
+    auto expected = program.substr(sizeof(prefix) - 1, end - (sizeof(prefix) - 1));
+    if (expected != actual) {
+        printf("FAIL %s\n    expected: %s\n      actual: %s\n", path, expected.c_str(), actual.c_str());
+        for (auto& e: hc.errors) printf("    %d: %s\n", e.pos, e.message.c_str());
+        return false;
+    }
+    return true;
+}
+
+// HCL's own characters, plus whitespace and high-bit bytes
+static const char alphabet[] = "cmpsfgkvbh0123456789 []{}=;'\"-+.,_$x\t\n\xff\x80";
+
+static std::string random_program(std::mt19937& rng)
+{
+    std::string program;
+    int length = rng() % 40;
+    for (int i = 0; i < length; ++i) {
+        program.push_back(alphabet[rng() % (sizeof(alphabet) - 1)]);
+    }
+    return program;
+}
+
+static std::string mutate(std::string program, std::mt19937& rng)
+{
+    int edits = 1 + rng() % 4;
+    for (int i = 0; i < edits; ++i) {
+        char ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        size_t at = program.empty() ? 0 : rng() % (program.size() + 1);
+        switch (rng() % 4) {
+        case 0: program.insert(at, 1, ch); break;
+        case 1: if (at < program.size()) program.erase(at, 1); break;
+        case 2: if (at < program.size()) program[at] = ch; break;
+        case 3: program.erase(at); break;
+        }
+    }
+    return program;
+}
+
+int main(int argc, char** argv)
+{
+    long iterations = 200000;
+    unsigned seed = 1;
+    bool print = false;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ("-n" == arg && i + 1 < argc) {
+            iterations = atol(argv[++i]);
+        } else if ("-s" == arg && i + 1 < argc) {
+            seed = unsigned(atol(argv[++i]));
+        } else if ("-p" == arg) {
+            print = true;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    int failures = 0;
+    std::vector<std::string> seeds;
+    for (auto path: files) {
+        if (!check_corpus_program(path, print)) ++failures;
+        std::string program;
+        if (read_file(path, program)) seeds.push_back(program);
+    }
+    if (print) return 0;
+    printf("corpus: %d programs, %d failed\n", int(files.size()), failures);
+
+    std::mt19937 rng(seed);
+    long with_errors = 0;
+    for (long i = 0; i < iterations; ++i) {
+        auto program = (seeds.empty() || (i & 1)) ? random_program(rng) : mutate(seeds[rng() % seeds.size()], rng);
+        HclCompiler hc;
+        std::vector<PackedMidiMessage> midi;
+        std::vector<HclParam> params;
+        if (!hc.compile(program, &midi, &params)) ++with_errors;
+        auto problem = check_invariants(program, hc, midi, params);
+        if (!problem.empty()) {
+            printf("FAIL fuzz seed %u iteration %ld: %s\n    program: ", seed, i, problem.c_str());
+            for (unsigned char ch: program) printf(isprint(ch) ? "%c" : "\\x%02x", ch);
+            printf("\n");
+            ++failures;
+            break;
+        }
+    }
+    printf("fuzz: %ld programs (seed %u), %ld with errors\n", iterations, seed, with_errors);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,17 @@
+// Minimal stand-in for the Rack SDK header: just enough for hcl.cpp and its includes.
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rack {
+namespace engine { struct Module; }
+}
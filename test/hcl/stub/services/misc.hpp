@@ -0,0 +1,12 @@
+// Stand-in for src/services/misc.hpp: the helpers hcl.cpp uses, without the Rack UI dependencies.
+#pragma once
+#include <rack.hpp>
+
+namespace pachde {
+
+#define U8(arg) static_cast<uint8_t>(arg)
+
+std::string format_string(const char *fmt, ...);
+template <typename T> bool in_range(T value, T minimum, T maximum) { return minimum <= value && value <= maximum; }
+
+}
@@ -0,0 +1,16 @@
+// Stand-in for src/services/perf-counters.hpp: the harness does its own timing.
+#pragma once
+#include <rack.hpp>
+
+namespace pachde {
+
+struct PerfTimer {};
+struct PerfGroup {
+    PerfGroup(rack::engine::Module*, const char*) {}
+    void add(const char*, PerfTimer*) {}
+};
+struct PerfScope {
+    explicit PerfScope(PerfTimer&) {}
+};
+
+}